@@ -0,0 +1,32 @@
+/**
+ * @file AllocationCounter.h
+ * @brief Header file for the process-wide allocation counter used by the benchmarks.
+ */
+#pragma once
+#include <QtGlobal>
+
+ /**
+  * @class AllocationCounter
+  * @brief Counts calls to the global operator new (and the bytes requested) in every thread.
+  * AllocationCounter.cpp replaces the global allocation functions, so it must be compiled into the executable itself.
+  * Qt containers and strings allocate their buffers with malloc and are not counted; QObjects, private
+  * implementations, std containers and std::function captures are.
+  */
+class AllocationCounter
+{
+public:
+    /**
+     * @struct Snapshot
+     * @brief Totals since program start. Subtract two snapshots to get the allocations in between.
+     */
+    struct Snapshot
+    {
+        qint64 count = 0;
+        qint64 bytes = 0;
+
+        Snapshot operator-(const Snapshot& earlier) const { return { count - earlier.count, bytes - earlier.bytes }; }
+    };
+
+    /** @brief Returns the current totals. */
+    static Snapshot snapshot();
+};
@@ -0,0 +1,219 @@
+/**
+ * @file BenchmarkSupport.cpp
+ * @brief Implementation of the helpers shared by the benchmark executables.
+ */
+#include "BenchmarkSupport.h"
+#include <Diagnostics/Tracer.h>
+#include <Model/DatabaseManager.h>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSqlQuery>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+#ifndef BMA_GIT_COMMIT
+#define BMA_GIT_COMMIT ""
+#endif
+
+namespace {
+    double mean(const QVector<qint64>& samples)
+    {
+        if (samples.isEmpty()) return 0.0;
+        double total = 0.0;
+        for (qint64 sample : samples) total += static_cast<double>(sample);
+        return total / samples.size();
+    }
+
+    QString sqliteVersion()
+    {
+        QSqlQuery query(DatabaseManager::instance().database());
+        return query.exec("SELECT sqlite_version()") && query.next() ? query.value(0).toString() : QString();
+    }
+}
+
+/** @brief Times are in milliseconds; rows/s is total rows over total time. */
+QJsonObject BenchmarkSupport::toJson(const Result& result)
+{
+    QVector<qint64> sorted = result.nanoseconds;
+    std::sort(sorted.begin(), sorted.end());
+    qint64 total = 0;
+    for (qint64 sample : sorted) total += sample;
+
+    const auto ms = [](qint64 nanoseconds) { return nanoseconds / 1e6; };
+    QJsonObject object;
+    object["name"] = result.name;
+    object["iterations"] = static_cast<int>(sorted.size());
+    object["rows"] = result.rows;
+    if (result.timedOut) {
+        object["timedOut"] = true;
+    }
+    if (sorted.isEmpty()) {
+        return object;
+    }
+    object["minMs"] = ms(sorted.first());
+    object["p50Ms"] = ms(percentile(sorted, 0.50));
+    object["p95Ms"] = ms(percentile(sorted, 0.95));
+    object["p99Ms"] = ms(percentile(sorted, 0.99));
+    object["maxMs"] = ms(sorted.last());
+    object["meanMs"] = ms(total) / sorted.size();
+    object["rowsPerSecond"] = total > 0 ? result.rows * 1e9 / total : 0.0;
+
+    QVector<qint64> allocations = result.allocations;
+    std::sort(allocations.begin(), allocations.end());
+    if (!allocations.isEmpty()) {
+        object["allocationsP50"] = percentile(allocations, 0.50);
+        object["allocationsMean"] = mean(allocations);
+        object["allocatedBytesMean"] = mean(result.allocatedBytes);
+    }
+    return object;
+}
+
+qint64 BenchmarkSupport::percentile(const QVector<qint64>& sorted, double fraction)
+{
+    if (sorted.isEmpty()) return 0;
+    const qsizetype rank = static_cast<qsizetype>(std::ceil(fraction * sorted.size()));
+    return sorted.at(qBound<qsizetype>(0, rank - 1, sorted.size() - 1));
+}
+
+qint64 BenchmarkSupport::parseCount(QString text)
+{
+    text = text.trimmed();
+    qint64 multiplier = 1;
+    if (text.endsWith('k', Qt::CaseInsensitive)) {
+        multiplier = 1000;
+        text.chop(1);
+    }
+    else if (text.endsWith('M')) {
+        multiplier = 1000000;
+        text.chop(1);
+    }
+    bool ok = false;
+    const qint64 value = text.toLongLong(&ok);
+    return ok && value > 0 ? value * multiplier : -1;
+}
+
+void BenchmarkSupport::addCommonOptions(QCommandLineParser& parser)
+{
+    parser.addOptions({
+        { "rows", "Transactions to generate (10k to 10M; k and M suffixes accepted).", "count", "10k" },
+        { "users", "Users to generate.", "count", "1" },
+        { "profiles", "Profiles per user.", "count", "4" },
+        { "categories", "Categories per profile.", "count", "12" },
+        { "accounts", "Financial accounts per profile.", "count", "4" },
+        { "years", "Years of history the transactions are spread over.", "count", "5" },
+        { "seed", "Seed of the data generator.", "seed", "20250101" },
+        { "batch", "Rows per addTransactions call while generating.", "count", "10000" },
+        { "iterations", "Timed calls per operation.", "count", "50" },
+        { "warmup", "Untimed calls before the timed ones.", "count", "2" },
+        { "filter", "Only run operations whose name matches this regular expression.", "regex" },
+        { "database", "Generate into this file (must not exist) instead of a temporary one.", "path" },
+        { "keep", "Keep the temporary database after the run." },
+        { "db-profile", "SQLite performance profile (durable or fast); overrides BMA_DB_PROFILE.", "name" },
+        { "label", "Free text stored in the report, e.g. the branch or change under test.", "text" },
+        { "output", "Write the JSON report to this file instead of stdout.", "path" },
+        { "trace", "Write a Chrome trace of the run to this file (debug builds, or BMA_ENABLE_TRACING).", "path" },
+    });
+}
+
+bool BenchmarkSupport::readScale(const QCommandLineParser& parser, SyntheticDataGenerator::Scale& scale)
+{
+    scale.transactions = parseCount(parser.value("rows"));
+    scale.users = static_cast<int>(parseCount(parser.value("users")));
+    scale.profilesPerUser = static_cast<int>(parseCount(parser.value("profiles")));
+    scale.categoriesPerProfile = static_cast<int>(parseCount(parser.value("categories")));
+    scale.accountsPerProfile = static_cast<int>(parseCount(parser.value("accounts")));
+    scale.years = static_cast<int>(parseCount(parser.value("years")));
+    scale.batchSize = static_cast<int>(parseCount(parser.value("batch")));
+    bool seedOk = false;
+    scale.seed = parser.value("seed").toUInt(&seedOk);
+
+    return seedOk && scale.transactions > 0 && scale.users > 0 && scale.profilesPerUser > 0 && scale.categoriesPerProfile > 0
+        && scale.accountsPerProfile > 0 && scale.years > 0 && scale.batchSize > 0;
+}
+/** @brief A temporary file is removed with the directory unless --keep is set; an explicit path is never overwritten. */
+QString BenchmarkSupport::prepareDatabase(const QCommandLineParser& parser, QTemporaryDir& temporaryDirectory)
+{
+    QString databasePath = parser.value("database");
+    if (databasePath.isEmpty()) {
+        if (!temporaryDirectory.isValid()) {
+            qCritical() << "Could not create a temporary directory:" << temporaryDirectory.errorString();
+            return QString();
+        }
+        temporaryDirectory.setAutoRemove(!parser.isSet("keep"));
+        databasePath = temporaryDirectory.filePath("benchmark.db");
+    }
+    else if (QFileInfo::exists(databasePath)) {
+        qCritical() << "Refusing to generate into existing file" << databasePath;
+        return QString();
+    }
+    if (parser.isSet("db-profile")) {
+        qputenv("BMA_DB_PROFILE", parser.value("db-profile").toUtf8());
+    }
+    DatabaseManager::setDatabasePath(databasePath);
+    return databasePath;
+}
+
+QJsonObject BenchmarkSupport::describeRun(const QCommandLineParser& parser, const QString& benchmark, const QString& databasePath,
+    const SyntheticDataGenerator::Scale& scale, const SyntheticDataGenerator::Dataset& dataset, qint64 generationNanoseconds)
+{
+    QJsonObject scaleJson;
+    scaleJson["transactions"] = scale.transactions;
+    scaleJson["users"] = scale.users;
+    scaleJson["profilesPerUser"] = scale.profilesPerUser;
+    scaleJson["categoriesPerProfile"] = scale.categoriesPerProfile;
+    scaleJson["accountsPerProfile"] = scale.accountsPerProfile;
+    scaleJson["years"] = scale.years;
+    scaleJson["seed"] = static_cast<qint64>(scale.seed);
+    scaleJson["benchmarkedProfileTransactions"] = dataset.transactionCounts.value(0);
+
+    QJsonObject generationJson;
+    generationJson["seconds"] = generationNanoseconds / 1e9;
+    generationJson["rowsPerSecond"] = generationNanoseconds > 0 ? dataset.insertedTransactions * 1e9 / generationNanoseconds : 0.0;
+    generationJson["databaseBytes"] = QFileInfo(databasePath).size();
+
+    QJsonObject report;
+    report["benchmark"] = benchmark;
+    report["label"] = parser.value("label");
+    report["commit"] = QString::fromLatin1(BMA_GIT_COMMIT);
+    report["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report["host"] = QSysInfo::prettyProductName();
+    report["cpuArchitecture"] = QSysInfo::currentCpuArchitecture();
+    report["qtVersion"] = QString::fromLatin1(qVersion());
+    report["sqliteVersion"] = sqliteVersion();
+    report["performanceProfile"] = DatabaseManager::instance().performanceProfile().name;
+    report["database"] = databasePath;
+    report["scale"] = scaleJson;
+    report["generation"] = generationJson;
+    return report;
+}
+
+void BenchmarkSupport::writeTrace(const QCommandLineParser& parser)
+{
+    if (!parser.isSet("trace")) return;
+#if BMA_TRACING_ENABLED
+    Tracer::instance().writeChromeTrace(parser.value("trace"));
+#else
+    qWarning() << "--trace ignored: tracing is compiled out of this build (configure with -DBMA_ENABLE_TRACING=ON).";
+#endif
+}
+
+bool BenchmarkSupport::writeReport(const QCommandLineParser& parser, const QJsonObject& report)
+{
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (!parser.isSet("output")) {
+        QTextStream(stdout) << json;
+        return true;
+    }
+
+    QFile output(parser.value("output"));
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate) || output.write(json) != json.size()) {
+        qCritical() << "Could not write" << output.fileName() << output.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file BenchmarkSupport.h
+ * @brief Command line, statistics and report helpers shared by the benchmark executables.
+ */
+#pragma once
+#include "SyntheticDataGenerator.h"
+#include <QCommandLineParser>
+#include <QJsonObject>
+#include <QString>
+#include <QTemporaryDir>
+#include <QVector>
+
+ /**
+  * @namespace BenchmarkSupport
+  * @brief Every benchmark executable accepts the same scale, database and report options and writes the same
+  * JSON layout, so reports from different commits and machines can be compared field by field.
+  */
+namespace BenchmarkSupport
+{
+    /**
+     * @struct Result
+     * @brief Measurements of one benchmarked operation; one entry per timed call in each vector.
+     */
+    struct Result
+    {
+        QString name;
+        QVector<qint64> nanoseconds;
+        QVector<qint64> allocations;        ///< operator new calls during the call (all threads).
+        QVector<qint64> allocatedBytes;     ///< Bytes requested from operator new during the call.
+        qint64 rows = 0;                    ///< Rows produced or written over all timed calls.
+        bool timedOut = false;              ///< True if a call never completed; the samples before it are kept.
+    };
+
+    /** @brief Reports min/p50/p95/p99/max/mean in milliseconds, rows/s and allocations per call. */
+    QJsonObject toJson(const Result& result);
+
+    /** @brief Nearest-rank percentile of sorted samples. */
+    qint64 percentile(const QVector<qint64>& sorted, double fraction);
+
+    /** @brief Parses a positive count with an optional k or M suffix ("250k", "10M"). Returns -1 if invalid. */
+    qint64 parseCount(QString text);
+
+    /** @brief Adds the scale, iteration, database and report options. */
+    void addCommonOptions(QCommandLineParser& parser);
+
+    /**
+     * @brief Reads the scale options.
+     * @return False if any of them is invalid.
+     */
+    bool readScale(const QCommandLineParser& parser, SyntheticDataGenerator::Scale& scale);
+
+    /**
+     * @brief Chooses the database file and performance profile and points DatabaseManager at them.
+     * Must run before DatabaseManager::instance() is first called.
+     * @param temporaryDirectory Holds the file unless --database is given; must outlive the DatabaseManager singleton.
+     * @return The database path, or an empty string on error.
+     */
+    QString prepareDatabase(const QCommandLineParser& parser, QTemporaryDir& temporaryDirectory);
+
+    /**
+     * @brief Builds the report header: run identification, environment, scale and data generation figures.
+     * @param benchmark Name of the benchmark ("repository" or "controller").
+     */
+    QJsonObject describeRun(const QCommandLineParser& parser, const QString& benchmark, const QString& databasePath,
+        const SyntheticDataGenerator::Scale& scale, const SyntheticDataGenerator::Dataset& dataset, qint64 generationNanoseconds);
+
+    /** @brief Writes the Chrome trace of the run to --trace, if given. */
+    void writeTrace(const QCommandLineParser& parser);
+
+    /**
+     * @brief Writes the report to --output, or to stdout.
+     * @return False if the file could not be written.
+     */
+    bool writeReport(const QCommandLineParser& parser, const QJsonObject& report);
+}
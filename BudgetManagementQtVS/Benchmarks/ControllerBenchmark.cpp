@@ -0,0 +1,150 @@
+/**
+ * @file ControllerBenchmark.cpp
+ * @brief Implementation of the controller level latency benchmark.
+ */
+#include "ControllerBenchmark.h"
+#include "AllocationCounter.h"
+#include "Controller/ChartsController.h"
+#include "Controller/DashboardController.h"
+#include "Controller/TransactionController.h"
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QDebug>
+
+namespace {
+    /** @brief Cycles through a list; warm-up iterations (negative) are mapped like the timed ones. */
+    template <typename T>
+    const T& cycle(const QVector<T>& values, int iteration)
+    {
+        return values.at(qAbs(iteration) % values.size());
+    }
+}
+
+ControllerBenchmark::ControllerBenchmark(const Options& options) : options(options)
+{
+}
+/**
+ * @brief Every view is shown (offscreen in CI) and sized like a desktop window, so layout and painting
+ * triggered by the update are part of the measured time, as they are for the user.
+ */
+void ControllerBenchmark::run(const SyntheticDataGenerator::Dataset& dataset)
+{
+    if (dataset.profileIds.isEmpty()) {
+        qDebug() << "ControllerBenchmark: no data set to run against.";
+        return;
+    }
+    BaseController::setUserId(dataset.userIds.first());
+    BaseController::setProfileId(dataset.profileIds.first());
+
+    // Transactions page: listing, search, sort and scrolling.
+    TransactionController transactionController;
+    TransactionWindow* transactionView = qobject_cast<TransactionWindow*>(transactionController.getView());
+    if (transactionView) {
+        transactionView->resize(1280, 800);
+        transactionView->show();
+
+        const auto transactionsPending = [&transactionController]() { return transactionController.isLoading(); };
+        measure("TransactionController.refreshTransactionsView", &transactionController, &BaseController::loadingFinished,
+            [&transactionController](int) { transactionController.run(); }, transactionsPending);
+
+        const QVector<QString> searches = { "gro", "pizza lunch", "salary", "2024-03", "expense", "rent deposit" };
+        measure("TransactionController.handleFilteringTransactionRequest", &transactionController, &BaseController::loadingFinished,
+            [transactionView, &searches](int iteration) { emit transactionView->searchTextRequest(cycle(searches, iteration)); }, transactionsPending);
+        emit transactionView->searchTextRequest(QString());
+        waitUntilIdle(transactionController);
+
+        const QVector<int> sortColumns = { 1, 2, 4, 6, 7, 0 };
+        measure("TransactionController.handleSortingRequest", &transactionController, &BaseController::loadingFinished,
+            [transactionView, &sortColumns](int iteration) { emit transactionView->columnSortRequest(cycle(sortColumns, iteration)); }, transactionsPending);
+
+        measure("TransactionController.loadNextPage", &transactionController, &BaseController::loadingFinished,
+            [transactionView](int) { emit transactionView->moreTransactionsRequested(); }, transactionsPending);
+        transactionView->hide();
+    }
+
+    // Charts page.
+    ChartsController chartsController;
+    if (QPointer<ChartsView> chartsView = chartsController.getView()) {
+        chartsView->resize(1280, 800);
+        chartsView->show();
+        measure("ChartsController.refreshData", &chartsController, &BaseController::loadingFinished,
+            [chartsView](int) { emit chartsView->dateRangeChanged(); }, [&chartsController]() { return chartsController.isLoading(); });
+        chartsView->hide();
+    }
+
+    // Navigation between the dashboard pages.
+    DashboardController dashboardController;
+    if (QPointer<DashboardView> dashboardView = dashboardController.getView()) {
+        dashboardView->resize(1280, 800);
+        dashboardView->show();
+
+        const QVector<QPair<DashboardView::SelectedPage, QString>> pages = {
+            { DashboardView::TransactionPage, "Transactions" },
+            { DashboardView::CategoryPage, "Categories" },
+            { DashboardView::FinancialAccountPage, "FinancialAccounts" },
+            { DashboardView::ChartsPage, "Charts" },
+        };
+        for (const auto& [page, pageName] : pages) {
+            measure("DashboardController.handlePageChange." + pageName, &dashboardController, &DashboardController::pageShown,
+                [dashboardView, page = page](int) { dashboardView->navigateToPage(page); }, []() { return true; });
+        }
+    }
+}
+
+QJsonArray ControllerBenchmark::resultsToJson() const
+{
+    QJsonArray array;
+    for (const BenchmarkSupport::Result& result : results) {
+        array.append(BenchmarkSupport::toJson(result));
+    }
+    return array;
+}
+/** @brief Runs a nested event loop, so queued continuations and repaints are processed exactly as in the application. */
+qint64 ControllerBenchmark::timeInteraction(const std::function<QMetaObject::Connection(const std::function<void()>& done)>& connectFinished,
+    const std::function<void()>& start, const std::function<bool()>& pending, qint64& allocations, qint64& allocatedBytes) const
+{
+    QEventLoop loop;
+    bool completed = false;
+    const QMetaObject::Connection connection = connectFinished([&completed, &loop]() {
+        completed = true;
+        loop.quit();
+        });
+
+    QTimer timeout;
+    timeout.setSingleShot(true);
+    QObject::connect(&timeout, &QTimer::timeout, &loop, &QEventLoop::quit);
+
+    const AllocationCounter::Snapshot before = AllocationCounter::snapshot();
+    QElapsedTimer timer;
+    timer.start();
+    start();
+    if (!completed && !pending()) {
+        completed = true;
+    }
+    if (!completed) {
+        timeout.start(options.timeoutMs);
+        loop.exec();
+    }
+    const qint64 elapsed = timer.nsecsElapsed();
+    const AllocationCounter::Snapshot allocated = AllocationCounter::snapshot() - before;
+    QObject::disconnect(connection);
+
+    allocations = allocated.count;
+    allocatedBytes = allocated.bytes;
+    if (!completed) {
+        qDebug() << "ControllerBenchmark: interaction did not complete within" << options.timeoutMs << "ms";
+        return -1;
+    }
+    return elapsed;
+}
+
+void ControllerBenchmark::waitUntilIdle(BaseController& controller) const
+{
+    if (!controller.isLoading()) return;
+
+    QEventLoop loop;
+    QTimer::singleShot(options.timeoutMs, &loop, &QEventLoop::quit);
+    QObject::connect(&controller, &BaseController::loadingFinished, &loop, &QEventLoop::quit);
+    loop.exec();
+}
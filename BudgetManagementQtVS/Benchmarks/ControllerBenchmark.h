@@ -0,0 +1,106 @@
+/**
+ * @file ControllerBenchmark.h
+ * @brief Header file for the controller level latency benchmark.
+ */
+#pragma once
+#include "BenchmarkSupport.h"
+#include "SyntheticDataGenerator.h"
+#include <QJsonArray>
+#include <QObject>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+class BaseController;
+
+ /**
+  * @class ControllerBenchmark
+  * @brief Drives the real controllers and views (normally under the offscreen platform) against a generated
+  * data set and measures user-perceived latency: from the signal a view would emit to the moment the controller
+  * reports that every query it started has finished and the view has been updated.
+  */
+class ControllerBenchmark
+{
+public:
+    /**
+     * @struct Options
+     * @brief Iteration counts and operation selection.
+     */
+    struct Options
+    {
+        int iterations = 50;            ///< Timed interactions per operation.
+        int warmup = 2;                 ///< Untimed interactions before the timed ones.
+        int timeoutMs = 60000;          ///< An interaction that does not complete in time ends its operation.
+        QRegularExpression filter;      ///< Only operations whose name matches are run; an empty pattern runs all.
+    };
+
+    explicit ControllerBenchmark(const Options& options);
+
+    /**
+     * @brief Runs every selected operation as the first user and profile of the data set.
+     * @param dataset IDs returned by SyntheticDataGenerator::generate.
+     */
+    void run(const SyntheticDataGenerator::Dataset& dataset);
+
+    /** @brief Returns the results as a JSON array of objects with percentiles and allocation counts. */
+    QJsonArray resultsToJson() const;
+
+private:
+    Options options;
+    QVector<BenchmarkSupport::Result> results;
+
+    /**
+     * @brief Times an interaction.
+     * @param name Reported name ("Controller.operation[.variant]").
+     * @param sender Object emitting the completion signal.
+     * @param finished Completion signal of sender.
+     * @param trigger Starts the interaction; called with the iteration index (negative during warm-up).
+     * @param pending Called right after trigger; false means nothing asynchronous was started and the
+     * interaction is already complete.
+     */
+    template <typename Sender, typename Signal>
+    void measure(const QString& name, Sender* sender, Signal finished, const std::function<void(int iteration)>& trigger,
+        const std::function<bool()>& pending);
+
+    /**
+     * @brief Waits for one interaction.
+     * @return Elapsed nanoseconds, or -1 on timeout.
+     */
+    qint64 timeInteraction(const std::function<QMetaObject::Connection(const std::function<void()>& done)>& connectFinished,
+        const std::function<void()>& start, const std::function<bool()>& pending, qint64& allocations, qint64& allocatedBytes) const;
+
+    /** @brief Lets queries still in flight from the previous operation finish before the next one starts. */
+    void waitUntilIdle(BaseController& controller) const;
+};
+
+template <typename Sender, typename Signal>
+void ControllerBenchmark::measure(const QString& name, Sender* sender, Signal finished, const std::function<void(int iteration)>& trigger,
+    const std::function<bool()>& pending)
+{
+    if (options.filter.isValid() && !options.filter.pattern().isEmpty() && !options.filter.match(name).hasMatch()) {
+        return;
+    }
+
+    const auto connectFinished = [sender, finished](const std::function<void()>& done) {
+        return QObject::connect(sender, finished, sender, [done]() { done(); });
+    };
+
+    BenchmarkSupport::Result result;
+    result.name = name;
+    for (int i = -options.warmup; i < options.iterations; ++i) {
+        qint64 allocations = 0;
+        qint64 allocatedBytes = 0;
+        const qint64 elapsed = timeInteraction(connectFinished, [&trigger, i]() { trigger(i); }, pending, allocations, allocatedBytes);
+        if (elapsed < 0) {
+            result.timedOut = true;
+            break;
+        }
+        if (i < 0) continue;
+
+        result.nanoseconds.append(elapsed);
+        result.allocations.append(allocations);
+        result.allocatedBytes.append(allocatedBytes);
+    }
+    results.append(result);
+}
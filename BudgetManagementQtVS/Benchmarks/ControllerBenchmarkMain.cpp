@@ -0,0 +1,77 @@
+/**
+ * @file ControllerBenchmarkMain.cpp
+ * @brief Entry point of the controller latency benchmark.
+ *
+ * Runs the real controllers and views on the offscreen platform (unless QT_QPA_PLATFORM says otherwise)
+ * against a generated SQLite database and prints the results as JSON. Run with --help for the options.
+ */
+#include "BenchmarkSupport.h"
+#include "ControllerBenchmark.h"
+#include "SyntheticDataGenerator.h"
+#include <Model/DatabaseManager.h>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QDebug>
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("BudgetManagementControllerBenchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures controller latency from view signal to view update and prints JSON.");
+    parser.addHelpOption();
+    BenchmarkSupport::addCommonOptions(parser);
+    parser.addOption({ "timeout", "Milliseconds an interaction may take before its operation is abandoned.", "ms", "60000" });
+    parser.process(app);
+
+    SyntheticDataGenerator::Scale scale;
+    ControllerBenchmark::Options options;
+    options.iterations = static_cast<int>(BenchmarkSupport::parseCount(parser.value("iterations")));
+    options.warmup = qMax(0, parser.value("warmup").toInt());
+    options.timeoutMs = static_cast<int>(BenchmarkSupport::parseCount(parser.value("timeout")));
+    options.filter = QRegularExpression(parser.value("filter"));
+    if (!BenchmarkSupport::readScale(parser, scale) || options.iterations <= 0 || options.timeoutMs <= 0 || !options.filter.isValid()) {
+        qCritical() << "Invalid option value; see --help.";
+        return 2;
+    }
+
+    // Declared static so it is removed only after the DatabaseManager singleton has closed the file.
+    static QTemporaryDir temporaryDirectory;
+    const QString databasePath = BenchmarkSupport::prepareDatabase(parser, temporaryDirectory);
+    if (databasePath.isEmpty()) {
+        return 1;
+    }
+    if (!DatabaseManager::instance().isSchemaCurrent()) {
+        qCritical() << DatabaseManager::instance().getSchemaError();
+        return 1;
+    }
+
+    SyntheticDataGenerator generator(scale);
+    QElapsedTimer generationTimer;
+    generationTimer.start();
+    const SyntheticDataGenerator::Dataset dataset = generator.generate();
+    const qint64 generationNanoseconds = generationTimer.nsecsElapsed();
+    if (dataset.insertedTransactions != scale.transactions) {
+        qCritical() << "Data generation failed after" << dataset.insertedTransactions << "transactions.";
+        return 1;
+    }
+
+    ControllerBenchmark benchmark(options);
+    benchmark.run(dataset);
+
+    QJsonObject report = BenchmarkSupport::describeRun(parser, "controller", databasePath, scale, dataset, generationNanoseconds);
+    report["platform"] = QApplication::platformName();
+    report["results"] = benchmark.resultsToJson();
+    BenchmarkSupport::writeTrace(parser);
+    if (!BenchmarkSupport::writeReport(parser, report)) {
+        return 1;
+    }
+    if (parser.isSet("keep")) {
+        qInfo().noquote() << "Database kept at" << databasePath;
+    }
+    return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file RepositoryBenchmark.cpp
+ * @brief Implementation of the repository layer benchmark.
+ */
+#include "RepositoryBenchmark.h"
+#include "AllocationCounter.h"
+#include <Model/DatabaseManager.h>
+#include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/DimensionCache.h>
+#include <Model/Repositories/FinancialAccountRepository.h>
+#include <Model/Repositories/ProfileRepository.h>
+#include <Model/Repositories/TransactionRepository.h>
+#include <Model/Repositories/UserRepository.h>
+#include <QElapsedTimer>
+#include <QSqlQuery>
+#include <QDebug>
+#include <limits>
+
+namespace {
+    const QString scratchName = QStringLiteral("Benchmark scratch");
+
+    /** @brief Spreads iteration indices over [0, count) so consecutive calls touch different rows. */
+    int spread(int iteration, int count)
+    {
+        return count > 0 ? static_cast<int>((static_cast<qint64>(qAbs(iteration)) * 7919) % count) : 0;
+    }
+}
+
+RepositoryBenchmark::RepositoryBenchmark(const Options& options) : options(options)
+{
+    batchInsert.name = "transactions.addTransactions";
+}
+/** @brief Batches are timed by the generator; each one is a sample of its own. */
+void RepositoryBenchmark::recordBatchInsert(int rows, qint64 nanoseconds)
+{
+    batchInsert.nanoseconds.append(nanoseconds);
+    batchInsert.rows += rows;
+}
+/**
+ * @brief Benchmarks run against the first profile of the first user. Reads come first, then the writes,
+ * which only touch rows they create themselves (named "Benchmark scratch") and delete them again.
+ */
+void RepositoryBenchmark::run(const SyntheticDataGenerator::Dataset& dataset)
+{
+    if (dataset.profileIds.isEmpty()) {
+        qDebug() << "RepositoryBenchmark: no data set to run against.";
+        return;
+    }
+    if (!batchInsert.nanoseconds.isEmpty()) {
+        results.append(batchInsert);
+    }
+
+    const TransactionRepository transactions;
+    const CategoryRepository categories;
+    const FinancialAccountRepository accounts;
+    const ProfileRepository profiles;
+    const UserRepository users;
+
+    const int userId = dataset.userIds.first();
+    const QString username = dataset.usernames.first();
+    const int profileId = dataset.profileIds.first();
+    const QVector<int>& categoryIds = dataset.categoryIds.first();
+    const QVector<int>& accountIds = dataset.accountIds.first();
+    const int transactionCount = static_cast<int>(qMin<qint64>(dataset.insertedTransactions, std::numeric_limits<int>::max()));
+    const QDate firstDate = dataset.firstDate;
+    const QDate lastDate = dataset.lastDate;
+    const int monthSpan = (lastDate.year() - firstDate.year()) * 12 + lastDate.month() - firstDate.month() + 1;
+
+    // Whole-profile and whole-table reads.
+    measure("transactions.getAll", options.heavyIterations, [&](int) {
+        return static_cast<qint64>(transactions.getAll().size());
+    });
+    measure("transactions.getAllProfileTransaction", options.heavyIterations, [&](int) {
+        return static_cast<qint64>(transactions.getAllProfileTransaction(profileId).size());
+    });
+    measure("transactions.getAllProfileTransactionRows", options.heavyIterations, [&](int) {
+        return static_cast<qint64>(transactions.getAllProfileTransactionRows(profileId).size());
+    });
+    measure("transactions.forEachUserTransaction", options.heavyIterations, [&](int) {
+        qint64 rows = 0;
+        transactions.forEachUserTransaction(userId, [&rows](const TransactionRepository::ExportRow&) { ++rows; return true; });
+        return rows;
+    });
+    measure("accounts.verifyBalances", options.heavyIterations, [&](int) {
+        return static_cast<qint64>(qMax(0, accounts.verifyBalances(false)) + 1);
+    });
+
+    // Paged listing.
+    const auto firstPage = [&](TransactionRepository::SortColumn column, Qt::SortOrder order, const QString& filter) {
+        TransactionRepository::PageRequest request;
+        request.profileId = profileId;
+        request.sortColumn = column;
+        request.order = order;
+        request.filter = filter;
+        return static_cast<qint64>(transactions.getTransactionPage(request).rows.size());
+    };
+    measure("transactions.getTransactionPage.date.first", options.iterations, [&](int) {
+        return firstPage(TransactionRepository::SortColumn::Date, Qt::DescendingOrder, QString());
+    });
+    measure("transactions.getTransactionPage.category.first", options.iterations, [&](int) {
+        return firstPage(TransactionRepository::SortColumn::Category, Qt::AscendingOrder, QString());
+    });
+    measure("transactions.getTransactionPage.filter.first", options.iterations, [&](int) {
+        return firstPage(TransactionRepository::SortColumn::Date, Qt::DescendingOrder, QStringLiteral("gro"));
+    });
+    TransactionRepository::PageRequest walk;
+    walk.profileId = profileId;
+    walk.sortColumn = TransactionRepository::SortColumn::Amount;
+    measure("transactions.getTransactionPage.amount.walk", options.iterations, [&](int) {
+        const TransactionRepository::Page page = transactions.getTransactionPage(walk);
+        walk.after = page.hasMore ? page.next : TransactionRepository::PageCursor();
+        return static_cast<qint64>(page.rows.size());
+    });
+    measure("transactions.search", options.iterations, [&](int) {
+        return static_cast<qint64>(transactions.search(profileId, QStringLiteral("pizza lunch"), 200).size());
+    });
+    measure("transactions.getTransactionById", options.iterations, [&](int iteration) {
+        return static_cast<qint64>(transactions.getTransactionById(1 + spread(iteration, transactionCount)).getTransactionId() > 0);
+    });
+
+    // Aggregates behind the dashboard, charts and budget bar.
+    measure("transactions.getMonthlyExpenses", options.iterations, [&](int iteration) {
+        const QDate month = firstDate.addMonths(spread(iteration, monthSpan));
+        transactions.getMonthlyExpenses(profileId, month.month(), month.year());
+        return qint64(1);
+    });
+    measure("transactions.getSumByTypeAndDate", options.iterations, [&](int iteration) {
+        const int edge = spread(iteration, 28);
+        transactions.getSumByTypeAndDate(profileId, TransactionType::Expense, firstDate.addDays(edge), lastDate.addDays(-edge));
+        return qint64(1);
+    });
+    measure("transactions.getAllTimeMonthlyAverageExpense", options.iterations, [&](int) {
+        transactions.getAllTimeMonthlyAverageExpense(profileId);
+        return qint64(1);
+    });
+    measure("transactions.getExpensesByCategory", options.iterations, [&](int iteration) {
+        const int edge = spread(iteration, 28);
+        return static_cast<qint64>(transactions.getExpensesByCategory(profileId, firstDate.addDays(edge), lastDate.addDays(-edge)).size());
+    });
+
+    // The same aggregates over the in-memory columns.
+    measure("transactions.loadColumnStore", options.heavyIterations, [&](int) {
+        TransactionColumnStore::instance().dropProfile(profileId);
+        return static_cast<qint64>(transactions.loadColumnStore(profileId));
+    });
+    measure("columnStore.sumByTypeAndDate.month", options.iterations, [&](int iteration) {
+        const QDate month = firstDate.addMonths(spread(iteration, monthSpan));
+        Money total;
+        TransactionColumnStore::instance().sumByTypeAndDate(profileId, TransactionType::Expense, month, month.addMonths(1).addDays(-1), total);
+        return qint64(1);
+    });
+    measure("columnStore.summarize", options.iterations, [&](int iteration) {
+        const int edge = spread(iteration, 28);
+        TransactionColumnStore::Summary summary;
+        TransactionColumnStore::instance().summarize(profileId, firstDate.addDays(edge), lastDate.addDays(-edge), summary);
+        return static_cast<qint64>(summary.expensesByCategory.size());
+    });
+
+    // Dimensions.
+    measure("categories.getAllProfileCategories", options.iterations, [&](int) {
+        return static_cast<qint64>(categories.getAllProfileCategories(profileId).size());
+    });
+    measure("categories.getCategoryNameById", options.iterations, [&](int iteration) {
+        categories.getCategoryNameById(categoryIds.at(spread(iteration, static_cast<int>(categoryIds.size()))));
+        return qint64(1);
+    });
+    measure("categories.getCategoryNameById.cold", options.iterations, [&](int iteration) {
+        DimensionCache::instance().clear();
+        categories.getCategoryNameById(categoryIds.at(spread(iteration, static_cast<int>(categoryIds.size()))));
+        return qint64(1);
+    });
+    measure("accounts.getAllProfileFinancialAccounts", options.iterations, [&](int) {
+        return static_cast<qint64>(accounts.getAllProfileFinancialAccounts(profileId).size());
+    });
+    measure("accounts.getFinancialAccountNameById", options.iterations, [&](int iteration) {
+        accounts.getFinancialAccountNameById(accountIds.at(spread(iteration, static_cast<int>(accountIds.size()))));
+        return qint64(1);
+    });
+    measure("profiles.getProfilesByUserId", options.iterations, [&](int) {
+        return static_cast<qint64>(profiles.getProfilesByUserId(userId).size());
+    });
+    measure("profiles.getBudgetLimit", options.iterations, [&](int) {
+        profiles.getBudgetLimit(profileId);
+        return qint64(1);
+    });
+    measure("users.checkIfUserExists", options.iterations, [&](int) {
+        return static_cast<qint64>(users.checkIfUserExists(username));
+    });
+    measure("users.getUserIdBasedOnUsername", options.iterations, [&](int) {
+        return static_cast<qint64>(users.getUserIdBasedOnUsername(username, SyntheticDataGenerator::password) > 0);
+    });
+
+    // Single-row writes on scratch rows.
+    const Transaction scratch(-1, scratchName, lastDate, QString(), Money::fromCents(1234), TransactionType::Expense,
+        categoryIds.first(), accountIds.first(), profileId);
+    measure("transactions.addTransaction", options.iterations, [&](int) {
+        return static_cast<qint64>(transactions.addTransaction(scratch));
+    });
+
+    QVector<int> scratchIds;
+    QSqlQuery scratchQuery(DatabaseManager::instance().database());
+    scratchQuery.prepare("SELECT id FROM transactions WHERE profile_id = :profile_id AND name = :name ORDER BY id");
+    scratchQuery.bindValue(":profile_id", profileId);
+    scratchQuery.bindValue(":name", scratchName);
+    if (scratchQuery.exec()) {
+        while (scratchQuery.next()) scratchIds.append(scratchQuery.value(0).toInt());
+    }
+    scratchQuery.finish();
+
+    measure("transactions.updateTransaction", options.iterations, [&](int iteration) {
+        if (scratchIds.isEmpty()) return qint64(0);
+        const int id = scratchIds.at(spread(iteration, static_cast<int>(scratchIds.size())));
+        const Transaction updated(id, scratchName, lastDate.addDays(-spread(iteration, 365)), QString(), Money::fromCents(1000 + iteration),
+            TransactionType::Expense, categoryIds.first(), accountIds.first(), profileId);
+        return static_cast<qint64>(transactions.updateTransaction(updated));
+    });
+    measure("transactions.removeTransactionById", options.iterations, [&](int) {
+        if (scratchIds.isEmpty()) return qint64(0);
+        return static_cast<qint64>(transactions.removeTransactionById(scratchIds.takeLast()));
+    });
+}
+/** @brief Warm-up calls are made first and discarded; each timed call is one sample. */
+void RepositoryBenchmark::measure(const QString& name, int iterations, const std::function<qint64(int iteration)>& call)
+{
+    if (options.filter.isValid() && !options.filter.pattern().isEmpty() && !options.filter.match(name).hasMatch()) {
+        return;
+    }
+    for (int i = 0; i < options.warmup; ++i) {
+        call(-1 - i);
+    }
+
+    BenchmarkSupport::Result result;
+    result.name = name;
+    result.nanoseconds.reserve(iterations);
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+        const AllocationCounter::Snapshot before = AllocationCounter::snapshot();
+        timer.start();
+        result.rows += call(i);
+        result.nanoseconds.append(timer.nsecsElapsed());
+        const AllocationCounter::Snapshot allocated = AllocationCounter::snapshot() - before;
+        result.allocations.append(allocated.count);
+        result.allocatedBytes.append(allocated.bytes);
+    }
+    qDebug().noquote() << "RepositoryBenchmark:" << name << "done";
+    results.append(result);
+}
+
+QJsonArray RepositoryBenchmark::resultsToJson() const
+{
+    QJsonArray array;
+    for (const BenchmarkSupport::Result& result : results) {
+        array.append(BenchmarkSupport::toJson(result));
+    }
+    return array;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file RepositoryBenchmark.h
+ * @brief Header file for the repository layer benchmark.
+ */
+#pragma once
+#include "BenchmarkSupport.h"
+#include "SyntheticDataGenerator.h"
+#include <QJsonArray>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+ /**
+  * @class RepositoryBenchmark
+  * @brief Times every public repository method against a generated data set and reports latency percentiles.
+  * Each method gets untimed warm-up calls (so statement preparation and a cold page cache do not skew the
+  * percentiles) followed by the timed iterations.
+  */
+class RepositoryBenchmark
+{
+public:
+    /**
+     * @struct Options
+     * @brief Iteration counts and method selection.
+     */
+    struct Options
+    {
+        int iterations = 50;            ///< Timed calls per method.
+        int heavyIterations = 5;        ///< Timed calls for methods that read every row of a profile or user.
+        int warmup = 2;                 ///< Untimed calls before the timed ones.
+        QRegularExpression filter;      ///< Only methods whose name matches are run; an empty pattern runs all.
+    };
+
+    explicit RepositoryBenchmark(const Options& options);
+
+    /**
+     * @brief Records one measurement per addTransactions batch of the generator.
+     * Pass as SyntheticDataGenerator::generate's callback.
+     */
+    void recordBatchInsert(int rows, qint64 nanoseconds);
+
+    /**
+     * @brief Runs every selected method against the generated data set.
+     * @param dataset IDs returned by SyntheticDataGenerator::generate.
+     */
+    void run(const SyntheticDataGenerator::Dataset& dataset);
+
+    /** @brief Returns the results as a JSON array of objects with p50/p95/p99 and rows/s. */
+    QJsonArray resultsToJson() const;
+
+private:
+    Options options;
+    BenchmarkSupport::Result batchInsert;
+    QVector<BenchmarkSupport::Result> results;
+
+    /**
+     * @brief Times a method.
+     * @param name Reported name ("repository.method[.variant]").
+     * @param iterations Timed calls.
+     * @param call Called with the iteration index (negative during warm-up); returns the rows it produced.
+     */
+    void measure(const QString& name, int iterations, const std::function<qint64(int iteration)>& call);
+};
@@ -0,0 +1,75 @@
+/**
+ * @file RepositoryBenchmarkMain.cpp
+ * @brief Entry point of the headless repository benchmark.
+ *
+ * Generates a deterministic data set in a temporary SQLite file, times every repository method against it
+ * and prints the results as JSON. Run with --help for the options.
+ */
+#include "BenchmarkSupport.h"
+#include "RepositoryBenchmark.h"
+#include "SyntheticDataGenerator.h"
+#include <Model/DatabaseManager.h>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QDebug>
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("BudgetManagementRepositoryBenchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times the repository layer against a generated SQLite database and prints JSON.");
+    parser.addHelpOption();
+    BenchmarkSupport::addCommonOptions(parser);
+    parser.addOption({ "heavy-iterations", "Timed calls for methods reading every row of a profile.", "count", "5" });
+    parser.process(app);
+
+    SyntheticDataGenerator::Scale scale;
+    RepositoryBenchmark::Options options;
+    options.iterations = static_cast<int>(BenchmarkSupport::parseCount(parser.value("iterations")));
+    options.heavyIterations = static_cast<int>(BenchmarkSupport::parseCount(parser.value("heavy-iterations")));
+    options.warmup = qMax(0, parser.value("warmup").toInt());
+    options.filter = QRegularExpression(parser.value("filter"));
+    if (!BenchmarkSupport::readScale(parser, scale) || options.iterations <= 0 || options.heavyIterations <= 0 || !options.filter.isValid()) {
+        qCritical() << "Invalid option value; see --help.";
+        return 2;
+    }
+
+    // Declared static so it is removed only after the DatabaseManager singleton has closed the file.
+    static QTemporaryDir temporaryDirectory;
+    const QString databasePath = BenchmarkSupport::prepareDatabase(parser, temporaryDirectory);
+    if (databasePath.isEmpty()) {
+        return 1;
+    }
+    if (!DatabaseManager::instance().isSchemaCurrent()) {
+        qCritical() << DatabaseManager::instance().getSchemaError();
+        return 1;
+    }
+
+    RepositoryBenchmark benchmark(options);
+    SyntheticDataGenerator generator(scale);
+    QElapsedTimer generationTimer;
+    generationTimer.start();
+    const SyntheticDataGenerator::Dataset dataset = generator.generate([&benchmark](int rows, qint64 nanoseconds) {
+        benchmark.recordBatchInsert(rows, nanoseconds);
+    });
+    const qint64 generationNanoseconds = generationTimer.nsecsElapsed();
+    if (dataset.insertedTransactions != scale.transactions) {
+        qCritical() << "Data generation failed after" << dataset.insertedTransactions << "transactions.";
+        return 1;
+    }
+
+    benchmark.run(dataset);
+
+    QJsonObject report = BenchmarkSupport::describeRun(parser, "repository", databasePath, scale, dataset, generationNanoseconds);
+    report["results"] = benchmark.resultsToJson();
+    BenchmarkSupport::writeTrace(parser);
+    if (!BenchmarkSupport::writeReport(parser, report)) {
+        return 1;
+    }
+    if (parser.isSet("keep")) {
+        qInfo().noquote() << "Database kept at" << databasePath;
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file SyntheticDataGenerator.cpp
+ * @brief Implementation of the deterministic benchmark data generator.
+ */
+#include "SyntheticDataGenerator.h"
+#include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/FinancialAccountRepository.h>
+#include <Model/Repositories/ProfileRepository.h>
+#include <Model/Repositories/TransactionRepository.h>
+#include <Model/Repositories/UserRepository.h>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <iterator>
+
+namespace {
+    const char* const merchants[] = {
+        "Grocery", "Bakery", "Pharmacy", "Fuel", "Cinema", "Restaurant", "Bookstore", "Electronics",
+        "Hardware", "Clothing", "Pet Shop", "Florist", "Train", "Taxi", "Gym", "Dentist",
+        "Insurance", "Internet", "Electricity", "Water", "Rent", "Coffee", "Pizza", "Market"
+    };
+    const char* const items[] = {
+        "weekly", "monthly", "snacks", "tickets", "repair", "gift", "subscription", "refill",
+        "lunch", "dinner", "supplies", "shoes", "medicine", "parking", "bundle", "deposit"
+    };
+    const char* const incomes[] = { "Salary", "Bonus", "Refund", "Interest", "Freelance", "Dividend" };
+    const char* const categoryNames[] = {
+        "Food", "Transport", "Housing", "Utilities", "Health", "Leisure", "Clothing", "Education",
+        "Gifts", "Travel", "Savings", "Pets", "Sport", "Electronics", "Insurance", "Other"
+    };
+    const char* const accountTypes[] = { "Cash", "Checking", "Savings", "Credit Card" };
+
+    template <typename T, std::size_t N>
+    const char* pick(QRandomGenerator& random, T (&words)[N])
+    {
+        return words[random.bounded(static_cast<quint32>(N))];
+    }
+}
+
+const QString SyntheticDataGenerator::password = QStringLiteral("benchmark");
+
+SyntheticDataGenerator::SyntheticDataGenerator(const Scale& scale) : scale(scale), random(scale.seed)
+{
+}
+/**
+ * @brief Creates the dimension rows first, then inserts transactions in batches of Scale::batchSize.
+ * Each transaction goes to a uniformly chosen profile; a tenth use the default category or account.
+ */
+SyntheticDataGenerator::Dataset SyntheticDataGenerator::generate(const std::function<void(int rows, qint64 nanoseconds)>& batchInserted)
+{
+    Dataset dataset;
+    dataset.lastDate = scale.endDate;
+    dataset.firstDate = scale.endDate.addYears(-scale.years).addDays(1);
+    if (!generateDimensions(dataset)) {
+        return dataset;
+    }
+
+    const TransactionRepository transactionRepository;
+    const qint64 daySpan = dataset.firstDate.daysTo(dataset.lastDate) + 1;
+    const int profileCount = static_cast<int>(dataset.profileIds.size());
+    dataset.transactionCounts.fill(0, profileCount);
+
+    QVector<Transaction> batch;
+    batch.reserve(scale.batchSize);
+    qint64 remaining = scale.transactions;
+    while (remaining > 0) {
+        const int batchRows = static_cast<int>(qMin<qint64>(remaining, scale.batchSize));
+        batch.clear();
+        for (int i = 0; i < batchRows; ++i) {
+            const int profileIndex = random.bounded(profileCount);
+            const QVector<int>& categories = dataset.categoryIds.at(profileIndex);
+            const QVector<int>& accounts = dataset.accountIds.at(profileIndex);
+            const bool income = random.bounded(100) < 12;
+            const int categoryId = random.bounded(10) == 0 ? 1 : categories.at(random.bounded(static_cast<int>(categories.size())));
+            const int accountId = random.bounded(10) == 0 ? 1 : accounts.at(random.bounded(static_cast<int>(accounts.size())));
+            const QDate date = dataset.firstDate.addDays(random.bounded(daySpan));
+
+            qint64 cents = income ? 150000 + random.bounded(650000) : 100 + random.bounded(20000);
+            if (!income && random.bounded(20) == 0) {
+                cents *= 20;
+            }
+
+            // Drawn in separate statements: the evaluation order of function arguments is unspecified.
+            const QString name = income ? QString::fromLatin1(pick(random, incomes)) : transactionName();
+            const QString description = transactionDescription();
+
+            batch.append(Transaction(-1, name, date, description, Money::fromCents(cents),
+                income ? TransactionType::Income : TransactionType::Expense, categoryId, accountId, dataset.profileIds.at(profileIndex)));
+            ++dataset.transactionCounts[profileIndex];
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        const TransactionRepository::BatchInsertResult result = transactionRepository.addTransactions(batch);
+        const qint64 elapsed = timer.nsecsElapsed();
+        if (!result.committed || result.insertedCount != batchRows) {
+            qDebug() << "SyntheticDataGenerator: batch insert failed:" << result.errors.value(0);
+            break;
+        }
+        if (batchInserted) {
+            batchInserted(batchRows, elapsed);
+        }
+        dataset.insertedTransactions += batchRows;
+        remaining -= batchRows;
+    }
+    return dataset;
+}
+/** @brief Adds users, their profiles, and each profile's categories and accounts, recording the new IDs. */
+bool SyntheticDataGenerator::generateDimensions(Dataset& dataset)
+{
+    const UserRepository userRepository;
+    const ProfileRepository profileRepository;
+    const CategoryRepository categoryRepository;
+    const FinancialAccountRepository financialAccountRepository;
+
+    for (int user = 0; user < scale.users; ++user) {
+        const QString username = QString("bench_user_%1").arg(user + 1);
+        if (!userRepository.addUser(username, password)) {
+            return false;
+        }
+        const int userId = userRepository.getUserIdBasedOnUsername(username, password);
+        if (userId < 0) {
+            return false;
+        }
+        dataset.userIds.append(userId);
+        dataset.usernames.append(username);
+
+        for (int profile = 0; profile < scale.profilesPerUser; ++profile) {
+            if (!profileRepository.addProfile(userId, QString("Profile %1").arg(profile + 1))) {
+                return false;
+            }
+        }
+        for (const Profile& profile : profileRepository.getProfilesByUserId(userId)) {
+            const int profileId = profile.getProfileId();
+            profileRepository.setBudgetLimit(profileId, Money::fromCents(250000 + random.bounded(500000)));
+
+            for (int category = 0; category < scale.categoriesPerProfile; ++category) {
+                const QString name = category < static_cast<int>(std::size(categoryNames))
+                    ? QString::fromLatin1(categoryNames[category])
+                    : QString("Category %1").arg(category + 1);
+                if (!categoryRepository.addCategory(name, profileId)) {
+                    return false;
+                }
+            }
+            for (int account = 0; account < scale.accountsPerProfile; ++account) {
+                const QString type = QString::fromLatin1(pick(random, accountTypes));
+                if (!financialAccountRepository.addFinancialAccount(QString("%1 %2").arg(type).arg(account + 1), type,
+                    Money::fromCents(random.bounded(1000000)), profileId)) {
+                    return false;
+                }
+            }
+
+            QVector<int> categoryIds;
+            for (const Category& category : categoryRepository.getAllProfileCategories(profileId)) {
+                if (category.getIdOfProfileConnectedToCategory() == profileId) categoryIds.append(category.getCategoryId());
+            }
+            QVector<int> accountIds;
+            for (const FinancialAccount& account : financialAccountRepository.getAllProfileFinancialAccounts(profileId)) {
+                if (account.getIdOfProfileConnectedToFinancialAccount() == profileId) accountIds.append(account.getFinancialAccountId());
+            }
+            if (categoryIds.isEmpty()) categoryIds.append(1);
+            if (accountIds.isEmpty()) accountIds.append(1);
+
+            dataset.profileIds.append(profileId);
+            dataset.categoryIds.append(categoryIds);
+            dataset.accountIds.append(accountIds);
+        }
+    }
+    return !dataset.profileIds.isEmpty();
+}
+/** @brief A merchant, usually followed by a purchase word, so FTS prefix queries have realistic selectivity. */
+QString SyntheticDataGenerator::transactionName()
+{
+    const QString merchant = QString::fromLatin1(pick(random, merchants));
+    if (random.bounded(4) == 0) {
+        return merchant;
+    }
+    return merchant + ' ' + QString::fromLatin1(pick(random, items));
+}
+/** @brief Empty for half of the rows, otherwise two purchase words and a reference number. */
+QString SyntheticDataGenerator::transactionDescription()
+{
+    if (random.bounded(2) == 0) {
+        return QString();
+    }
+    const QString first = QString::fromLatin1(pick(random, items));
+    const QString second = QString::fromLatin1(pick(random, items));
+    return QString("%1 %2 #%3").arg(first, second).arg(random.bounded(100000));
+}
@@ -0,0 +1,75 @@
+/**
+ * @file SyntheticDataGenerator.h
+ * @brief Header file for the deterministic benchmark data generator.
+ */
+#pragma once
+#include <QDate>
+#include <QRandomGenerator>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+
+ /**
+  * @class SyntheticDataGenerator
+  * @brief Fills the database opened by DatabaseManager with users, profiles, categories, accounts and transactions.
+  * Everything is written through the repositories, so triggers, the FTS index and the rollups are maintained
+  * exactly as in the application. The same seed and scale always produce the same rows.
+  */
+class SyntheticDataGenerator
+{
+public:
+    /**
+     * @struct Scale
+     * @brief Shape of the generated data set.
+     */
+    struct Scale
+    {
+        qint64 transactions = 10000;    ///< Total transaction rows, spread over every profile.
+        int users = 1;
+        int profilesPerUser = 4;
+        int categoriesPerProfile = 12;
+        int accountsPerProfile = 4;
+        int years = 5;                  ///< Transactions are dated within this many years before endDate.
+        QDate endDate = QDate(2025, 12, 31);
+        quint32 seed = 20250101;
+        int batchSize = 10000;          ///< Rows per addTransactions call (one SQLite transaction each).
+    };
+
+    /**
+     * @struct Dataset
+     * @brief IDs of the generated rows, needed by the benchmarks to address them.
+     */
+    struct Dataset
+    {
+        QVector<int> userIds;
+        QStringList usernames;
+        QVector<int> profileIds;
+        QVector<QVector<int>> categoryIds;  ///< Per profile, in profileIds order.
+        QVector<QVector<int>> accountIds;   ///< Per profile, in profileIds order.
+        QVector<qint64> transactionCounts;  ///< Rows inserted per profile, in profileIds order.
+        qint64 insertedTransactions = 0;
+        QDate firstDate;
+        QDate lastDate;
+    };
+
+    /** @brief Password of every generated user. */
+    static const QString password;
+
+    explicit SyntheticDataGenerator(const Scale& scale);
+
+    /**
+     * @brief Writes the data set.
+     * @param batchInserted Optional; called after every addTransactions batch with its size and duration.
+     * @return The generated IDs; insertedTransactions is smaller than requested if a batch failed.
+     */
+    Dataset generate(const std::function<void(int rows, qint64 nanoseconds)>& batchInserted = {});
+
+private:
+    Scale scale;
+    QRandomGenerator random;
+
+    bool generateDimensions(Dataset& dataset);
+    QString transactionName();
+    QString transactionDescription();
+};
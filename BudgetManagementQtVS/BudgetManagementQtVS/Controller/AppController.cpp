@@ -3,17 +3,34 @@
  * @brief Implementation of the main Application Controller.
  */
 #include "Controller/AppController.h"
+#include "Model/Repositories/StatementCache.h"
+#include "Model/Repositories/TransactionColumnStore.h"
+#include "Diagnostics/Tracer.h"
+#include "Diagnostics/QueryLog.h"
 
- /** @brief Constructor. Initializes the DataController and connects quit signals. */
+ /** @brief Constructor. Initializes the DataController, starts the auto-save worker and connects quit signals. */
 AppController::AppController(QObject* parent) : QObject(parent) 
 {
     dataController = new DataController(profileRepo, this);
+
+    autoSaver = new AutoSaver();
+    autoSaver->moveToThread(&autoSaveThread);
+    connect(&autoSaveThread, &QThread::finished, autoSaver, &QObject::deleteLater);
+    autoSaveThread.setObjectName("AutoSave");
+    autoSaveThread.start(QThread::LowestPriority);
+
+    autoSaveTimer = new QTimer(this);
+    autoSaveTimer->setInterval(autoSaveIntervalMs);
+    connect(autoSaveTimer, &QTimer::timeout, this, &AppController::requestAutoSave);
+    autoSaveTimer->start();
+
     connect(qApp, &QCoreApplication::aboutToQuit, this, &AppController::onAppAboutToQuit);
 }
-/** @brief Destructor. Deletes the active sub-controller. */
+/** @brief Destructor. Deletes the active sub-controller and joins the auto-save worker. */
 AppController::~AppController()
 {
 	delete currentController;
+    stopAutoSave();
 }
 /** @brief Initializes the Login flow using UserController. */
 void AppController::start()
@@ -42,16 +59,25 @@ void AppController::showProfileSelection()
 
     currentController->run();
 }
-/** @brief Resets user session IDs and restarts the app flow. */
+/** @brief Resets user session IDs, evicts every loaded profile from the TransactionColumnStore and restarts the app flow. */
 void AppController::handleLogout()
 {
+    requestAutoSave();
     BaseController::setUserId(-1);
     BaseController::setProfileId(-1);
+    TransactionColumnStore::instance().clear();
     start();
 }
-/** @brief Resets only the profile ID and returns to profile selection. */
+/**
+ * @brief Resets only the profile ID and returns to profile selection. The profile being left is evicted
+ * from the TransactionColumnStore, so only the active profile stays resident.
+ */
 void AppController::handleSwitchingProfile()
 {
+    const int leftProfileId = BaseController::getProfileId();
+    if (leftProfileId >= 0) {
+        TransactionColumnStore::instance().dropProfile(leftProfileId);
+    }
     BaseController::setProfileId(-1);
     delete currentController;
 
@@ -62,21 +88,50 @@ void AppController::showDashboard()
 {
 	delete currentController;
 
-	DashboardController* dashCtrl = new DashboardController(profileRepo, transactionRepo, categoryRepo, fAccRepo);
+	DashboardController* dashCtrl = new DashboardController();
     currentController = dashCtrl;
 
     connect(dashCtrl, &DashboardController::logoutRequested, this, &AppController::handleSwitchingProfile);
 
     currentController->run();
 }
-/** @brief Triggered on app exit. Auto-saves data if a user is logged in. */
+/**
+ * @brief Triggered on app exit. Does no file I/O: changes not yet saved stay in the change log
+ * and are appended by the next session's first auto-save.
+ */
 void AppController::onAppAboutToQuit()
 {
-    int currentUserId = BaseController::getUserId();
+    stopAutoSave();
+
+    qDebug() << "Statement cache: hits" << StatementCache::getHitCount()
+        << "prepares" << StatementCache::getMissCount()
+        << "evictions" << StatementCache::getEvictionCount()
+        << "prepare time (ms)" << StatementCache::getPrepareNanoseconds() / 1000000.0;
+    QueryLog::instance().writeSummary();
 
-    if (currentUserId != -1) {
-        if (dataController) {
-            dataController->autoSaveData(currentUserId);
-        }
+#if BMA_TRACING_ENABLED
+    if (!Tracer::instance().outputPath().isEmpty()) {
+        Tracer::instance().writeChromeTrace();
     }
+#endif
+}
+/** @brief Posts saveChanges to the worker; returns immediately. */
+void AppController::requestAutoSave()
+{
+    const int currentUserId = BaseController::getUserId();
+    if (currentUserId == -1 || !autoSaveThread.isRunning()) return;
+
+    QMetaObject::invokeMethod(autoSaver, [saver = autoSaver, currentUserId]() {
+        saver->saveChanges(currentUserId);
+        }, Qt::QueuedConnection);
+}
+
+void AppController::stopAutoSave()
+{
+    if (!autoSaveThread.isRunning()) return;
+
+    autoSaveTimer->stop();
+    autoSaver->requestCancel();
+    autoSaveThread.quit();
+    autoSaveThread.wait();
 }
\ No newline at end of file
@@ -6,12 +6,15 @@
 
 #include <QObject>
 #include <QPointer>
+#include <QThread>
+#include <QTimer>
 
 #include "Controller/BaseController.h"
 #include "Controller/UserController.h"
 #include "Controller/ProfileController.h"
 #include "Controller/DashboardController.h"
 #include "Controller/DataController.h"
+#include "Model/AutoSaver.h"
 #include "Model/Repositories/UserRepository.h"
 #include "Model/Repositories/ProfileRepository.h"
 
@@ -51,15 +54,23 @@ private slots:
     /** @brief Handles switching profiles within the same user session. */
     void handleSwitchingProfile();
 
-    /** @brief Slot triggered when the application is about to close (e.g., for auto-save). */
+    /** @brief Slot triggered when the application is about to close. Stops the auto-save worker without saving and logs statement cache counters. */
     void onAppAboutToQuit();
+
+    /** @brief Queues an incremental auto-save of the logged-in user on the worker thread. */
+    void requestAutoSave();
 private:
     UserRepository userRepo;
     ProfilesRepository profileRepo;
-    TransactionRepository transactionRepo;
-    CategoryRepository categoryRepo;
-    FinancialAccountRepository fAccRepo;
 
     QPointer<BaseController> currentController; ///< Points to the currently active sub-controller.
     DataController* dataController;             ///< Helper controller for data persistence operations.
+
+    static constexpr int autoSaveIntervalMs = 30000;    ///< Period of the background auto-save.
+    QThread autoSaveThread;                     ///< Worker thread owning autoSaver and its connection.
+    AutoSaver* autoSaver;                       ///< Lives on autoSaveThread; deleted when it finishes.
+    QTimer* autoSaveTimer;                      ///< Triggers requestAutoSave periodically.
+
+    /** @brief Cancels any running save and joins the worker thread. */
+    void stopAutoSave();
 };
\ No newline at end of file
@@ -75,4 +75,28 @@ Qt::SortOrder BaseController::getLastSortingOrder() const
 {
 	return lastSortingOrder;
 }
+/** @brief Turns the indicator on with the first pending query. */
+void BaseController::beginLoading()
+{
+	if (pendingLoads++ == 0) {
+		showLoading(true);
+	}
+}
+/**
+ * @brief Turns the indicator off when the last pending query finishes.
+ * Continuations call this before updating the view, so loadingFinished() is queued to run after them.
+ */
+void BaseController::endLoading()
+{
+	if (pendingLoads > 0 && --pendingLoads == 0) {
+		showLoading(false);
+		QMetaObject::invokeMethod(this, [this]() {
+			if (pendingLoads == 0) emit loadingFinished();
+			}, Qt::QueuedConnection);
+	}
+}
 
+bool BaseController::isLoading() const
+{
+	return pendingLoads > 0;
+}
@@ -25,7 +25,24 @@ public:
 	static void setUserId(int userId);
 	static int getProfileId();
 	static int getUserId();
+
+	/** @brief Returns true while any asynchronous query started with beginLoading() is pending. */
+	bool isLoading() const;
+signals:
+	/**
+	 * @brief Emitted when the last pending asynchronous query has finished and its continuation has updated the view.
+	 * Delivered through the event loop, so it always follows the view update.
+	 */
+	void loadingFinished();
 protected:
+	// Loading Indicator
+	/** @brief Marks the start of an asynchronous query; the view shows its loading indicator while any are pending. */
+	void beginLoading();
+	/** @brief Marks the end of an asynchronous query started with beginLoading(). */
+	void endLoading();
+	/** @brief Shows or hides the view's loading indicator. The default does nothing. */
+	virtual void showLoading(bool loading) {}
+
 	// Filtering & Sorting Helpers
 	QString getFilteringText();
 	void setFilteringText(const QString& searchText);
@@ -81,4 +98,5 @@ private:
 	QString filteringText = "";
 	int selectedColumnId = -1;
 	Qt::SortOrder lastSortingOrder = Qt::SortOrder::AscendingOrder;
+	int pendingLoads = 0;	///< Asynchronous queries in flight.
 };
\ No newline at end of file
@@ -3,14 +3,14 @@
  * @brief Implementation of the Category Controller.
  */
 #include "Controller/CategorySelectionController.h"
+#include "Diagnostics/Tracer.h"
 #include <QInputDialog>
 #include <QMessageBox>
 #include <algorithm>
 
  /** @brief Constructor. Creates view and sets up connections. */
-CategoryController::CategoryController(CategoryRepository& categoryRepositoryRef, QObject* parent)
-    : BaseController(parent),
-    categoryRepository(categoryRepositoryRef)
+CategoryController::CategoryController(QObject* parent)
+    : BaseController(parent)
 {
     categoryView = new CategorySelectionView();
     setupCategoryView();
@@ -77,54 +77,91 @@ void CategoryController::showCategories()
 {
     refreshTable();
 }
-/** @brief Fetches data, applies filter/sort, and updates the view. */
+/** @brief Forwards the loading state to the view. */
+void CategoryController::showLoading(bool loading)
+{
+    if (categoryView) categoryView->setLoading(loading);
+}
+/** @brief Fetches data on the database pool, then applies filter/sort and updates the view. */
 void CategoryController::refreshTable()
 {
-    QVector<Category> categories = categoryRepository.getAllProfileCategories(getUserId());
-
+    BMA_TRACE_SCOPE("controller", "CategoryController::refreshTable");
+    const int userId = getUserId();
+    const quint64 generation = ++refreshGeneration;
+
+    beginLoading();
+    AsyncRepository::instance().categories([userId](const CategoryRepository& repository) {
+        return repository.getAllProfileCategories(userId);
+        }).then(this, [this, generation](QVector<Category> categories) {
+            BMA_TRACE_SCOPE("controller", "CategoryController::refreshTable.result");
+            endLoading();
+            if (generation != refreshGeneration || !categoryView) return;
+
+            loadedCategories = std::move(categories);
+            updateTable();
+            emit categoriesDataChanged();
+            });
+}
+/** @brief Applies filter/sort to the cached categories and updates the view. */
+void CategoryController::updateTable()
+{
+    BMA_TRACE_SCOPE("controller", "CategoryController::updateTable");
+    QVector<Category> categories = loadedCategories;
 
     if (!getFilteringText().isEmpty()) {
         categories = executeFilteringCategory(categories);
     }
 
-
     executeSortingCategory(categories);
 
-
-    QVector<QStringList> viewData;
-    for (const auto& cat : categories) {
-        QStringList row;
-        row << QString::number(cat.getCategoryId());
-        row << cat.getCategoryName();
-        viewData.append(row);
-    }
-
-
-    categoryView->setCategoryTabHeaders(viewData);
-    emit categoriesDataChanged();
+    categoryView->setCategories(std::move(categories));
 }
 
 /** @brief Adds a category via repository and updates UI. */
 void CategoryController::handleAddCategoryRequest(const QString& categoryName)
 {
-    if (categoryRepository.addCategory(categoryName, getUserId())) {
-        categoryView->showMessage("Success", "Category added successfully.", "info");
-        refreshTable();
-    }
-    else {
-        categoryView->showMessage("Error", "Failed to add category.", "error");
-    }
+    const int userId = getUserId();
+
+    beginLoading();
+    AsyncRepository::instance().categories([categoryName, userId](const CategoryRepository& repository) {
+        return repository.addCategory(categoryName, userId);
+        }).then(this, [this](bool added) {
+            endLoading();
+            if (!categoryView) return;
+
+            if (added) {
+                categoryView->showMessage("Success", "Category added successfully.", "info");
+                refreshTable();
+            }
+            else {
+                categoryView->showMessage("Error", "Failed to add category.", "error");
+            }
+            });
 }
 /** @brief Updates a category via repository and updates UI. */
 void CategoryController::handleEditCategoryRequest(int categoryId, const QString& newName)
 {
-    if (categoryRepository.updateCategory(categoryId, newName)) {
-        categoryView->showMessage("Success", "Category updated.", "info");
-        refreshTable();
-    }
-    else {
-        categoryView->showMessage("Error", "Failed to update category.", "error");
-    }
+    const int userId = getUserId();
+
+    beginLoading();
+    AsyncRepository::instance().categories([categoryId, newName](const CategoryRepository& repository) {
+        return repository.updateCategory(categoryId, newName);
+        }).then(this, [this, categoryId, newName, userId](bool updated) {
+            endLoading();
+            if (!categoryView) return;
+
+            if (updated) {
+                categoryView->showMessage("Success", "Category updated.", "info");
+                for (Category& category : loadedCategories) {
+                    if (category.getCategoryId() == categoryId) category = Category(categoryId, newName, userId);
+                }
+                updateTable();
+                emit categoriesDataChanged();
+            }
+            else {
+                categoryView->showMessage("Error", "Failed to update category.", "error");
+            }
+            });
 }
 /** @brief Deletes a category and updates UI. */
 void CategoryController::handleDeleteCategoryRequest(int categoryId)
@@ -134,25 +171,37 @@ void CategoryController::handleDeleteCategoryRequest(int categoryId)
         return;
     }
 
-    if (categoryRepository.removeCategoryById(categoryId)) {
-        categoryView->showMessage("Success", "Category deleted.", "info");
-        refreshTable();
-    }
-    else {
-        categoryView->showMessage("Error", "Failed to delete category (might be in use).", "error");
-    }
+    beginLoading();
+    AsyncRepository::instance().categories([categoryId](const CategoryRepository& repository) {
+        return repository.removeCategoryById(categoryId);
+        }).then(this, [this, categoryId](bool removed) {
+            endLoading();
+            if (!categoryView) return;
+
+            if (removed) {
+                categoryView->showMessage("Success", "Category deleted.", "info");
+                categoryView->removeCategory(categoryId);
+                loadedCategories.erase(std::remove_if(loadedCategories.begin(), loadedCategories.end(),
+                    [categoryId](const Category& category) { return category.getCategoryId() == categoryId; }),
+                    loadedCategories.end());
+                emit categoriesDataChanged();
+            }
+            else {
+                categoryView->showMessage("Error", "Failed to delete category (might be in use).", "error");
+            }
+            });
 }
-/** @brief Stores filter text and refreshes. */
+/** @brief Stores filter text and re-filters the cached categories. */
 void CategoryController::handleFilteringCategoryRequest(const QString& searchText)
 {
     setFilteringText(searchText);
-    refreshTable();
+    updateTable();
 }
-/** @brief Stores sort column and refreshes. */
+/** @brief Stores sort column and re-sorts the cached categories. */
 void CategoryController::handleSortRequest(int columnId)
 {
     setSelectedColumnId(columnId);
-    refreshTable();
+    updateTable();
 }
 /** @brief Implementation of filtering for Categories. */
 QVector<Category> CategoryController::executeFilteringCategory(const QVector<Category> allCategories)
@@ -3,7 +3,7 @@
  * @brief Header file for the Category Controller.
  */
 #pragma once
-#include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/AsyncRepository.h>
 #include "Model/Category.h"
 
 #include <Controller/BaseController.h>
@@ -31,11 +31,10 @@ class CategoryController : public BaseController
 
 public:
     /**
-     * @brief Constructs the controller.
-     * @param categoryRepositoryRef Reference to the category repository.
+     * @brief Constructs the controller. Categories are queried on the database pool.
      * @param parent Parent QObject.
      */
-    CategoryController(CategoryRepository& categoryRepositoryRef, QObject* parent = nullptr);
+    explicit CategoryController(QObject* parent = nullptr);
 
     /** @brief Initializes the controller logic. */
     void run();
@@ -63,13 +62,18 @@ public slots:
     void handleFilteringCategoryRequest(const QString& searchText);
     /** @brief Handles sorting requests. */
     void handleSortRequest(int columnId);
+protected:
+    void showLoading(bool loading) override;
 private:
     QPointer<CategorySelectionView> categoryView;
-    CategoryRepository& categoryRepository;
 
     int selectedCategoryIdForTransaction = 1; // Default/Protected ID
+    QVector<Category> loadedCategories;     ///< Last query result; filtering and sorting reuse it.
+    quint64 refreshGeneration = 0;          ///< Results of superseded refreshes are dropped.
 
     void refreshTable();
+    /** @brief Applies the current filter and sort to loadedCategories and shows the result. */
+    void updateTable();
     QVector<Category> executeFilteringCategory(const QVector<Category> allCategories);
     void executeSortingCategory(QVector<Category>& allCategories);
     void executeSortingCategory(QVector<Category>& allCategories) const;
@@ -3,15 +3,13 @@
  * @brief Implementation of the Charts Controller.
  */
 #include "Controller/ChartsController.h"
+#include "Diagnostics/Tracer.h"
 #include <QDate>
 #include <map>
 
  /** @brief Constructor. Creates view and connects date change signals. */
-ChartsController::ChartsController(TransactionRepository& transRepo, CategoryRepository& catRepo,
-    QObject* parent)
+ChartsController::ChartsController(QObject* parent)
     : BaseController(parent),
-	transactionRepository(transRepo),
-    categoryRepository(catRepo),
     view(new ChartsView())
 {
     connect(view, &ChartsView::dateRangeChanged, this, &ChartsController::refreshData);
@@ -26,41 +24,72 @@ QPointer<ChartsView> ChartsController::getView() const
 {
     return view;
 }
+/** @brief Forwards the loading state to the view. */
+void ChartsController::showLoading(bool loading)
+{
+    if (view) view->setLoading(loading);
+}
 /**
- * @brief Fetches aggregated data (Sums, Averages) from repositories and updates charts.
+ * @brief Fetches aggregated data (Sums, Averages) on the database pool and updates charts.
+ * Only the latest request updates the view, so dragging the date range never shows stale figures.
  */
 void ChartsController::refreshData() {
-    int profileId = getProfileId();
-    QDate start = view->getStartDateEdit()->date();
-    QDate end = view->getEndDateEdit()->date();
-
-    double income = transactionRepository.getSumByTypeAndDate(profileId, "Income", start, end);
-    double expense = transactionRepository.getSumByTypeAndDate(profileId, "Expense", start, end);
-    double avg = transactionRepository.getAllTimeMonthlyAverageExpense(profileId);
+    BMA_TRACE_SCOPE("controller", "ChartsController::refreshData");
+    if (!view) return;
 
-    view->setIncomeValue(income);
-    view->setExpenseValue(expense);
-    view->setAverageValue(avg);
+    const int profileId = getProfileId();
+    const QDate start = view->getStartDateEdit()->date();
+    const QDate end = view->getEndDateEdit()->date();
+    const quint64 generation = ++refreshGeneration;
 
+    beginLoading();
+    AsyncRepository::instance().run([profileId, start, end]() {
+        return loadChartData(profileId, start, end);
+        }).then(this, [this, generation](ChartData data) {
+            BMA_TRACE_SCOPE("controller", "ChartsController::refreshData.result");
+            endLoading();
+            if (generation != refreshGeneration || !view) return;
 
-    view->updateBarChart(income, expense);
+            const double income = data.income.toDouble();
+            const double expense = data.expense.toDouble();
 
+            view->setIncomeValue(income);
+            view->setExpenseValue(expense);
+            view->setAverageValue(data.monthlyAverage.toDouble());
 
+            view->updateBarChart(income, expense);
+            view->updatePieChart(data.expensesByCategory);
+            });
+}
 
-    QMap<int, double> rawCatData = transactionRepository.getExpensesByCategory(profileId, start, end);
+ChartsController::ChartData ChartsController::loadChartData(int profileId, const QDate& start, const QDate& end)
+{
+    BMA_TRACE_SCOPE("controller", "ChartsController::loadChartData");
+    TransactionRepository transactionRepository;
+    CategoryRepository categoryRepository;
 
+    ChartData data;
+    QMap<int, Money> rawCatData;
+    TransactionColumnStore::Summary summary;
+    if (transactionRepository.loadColumnStore(profileId)
+        && TransactionColumnStore::instance().summarize(profileId, start, end, summary)) {
+        data.income = summary.income;
+        data.expense = summary.expense;
+        data.monthlyAverage = summary.monthlyAverageExpense;
+        rawCatData = summary.expensesByCategory;
+    }
+    else {
+        data.income = transactionRepository.getSumByTypeAndDate(profileId, TransactionType::Income, start, end);
+        data.expense = transactionRepository.getSumByTypeAndDate(profileId, TransactionType::Expense, start, end);
+        data.monthlyAverage = transactionRepository.getAllTimeMonthlyAverageExpense(profileId);
+        rawCatData = transactionRepository.getExpensesByCategory(profileId, start, end);
+    }
 
-    QMap<QString, double> pieChartData;
     for (auto it = rawCatData.begin(); it != rawCatData.end(); ++it) {
-        int catId = it.key();
-        double amount = it.value();
-
-        QString catName = categoryRepository.getCategoryNameById(catId);
+        QString catName = categoryRepository.getCategoryNameById(it.key());
         if (catName.isEmpty()) catName = "Unknown";
 
-        pieChartData.insert(catName, amount);
+        data.expensesByCategory.insert(catName, it.value().toDouble());
     }
-
-    view->updatePieChart(pieChartData);
+    return data;
 }
-
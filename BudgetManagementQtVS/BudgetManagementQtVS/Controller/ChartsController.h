@@ -5,8 +5,7 @@
 #pragma once
 #include <Controller/BaseController.h>
 
-#include <Model/Repositories/TransactionRepository.h>
-#include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/AsyncRepository.h>
 
 #include <View/TransactionWindowView.h>
 #include "View/ChartsDialogView.h"
@@ -22,7 +21,7 @@ class ChartsController : public BaseController
 
 public:
     /** @brief Constructs the controller. */
-    ChartsController(TransactionRepository& transRepo, CategoryRepository& catRepo, QObject* parent = nullptr);
+    explicit ChartsController(QObject* parent = nullptr);
 
     /** @brief Starts the controller (refreshes data). */
     void run() override;
@@ -31,12 +30,28 @@ public:
     QPointer<ChartsView> getView() const;
 
 public slots:
-    /** @brief Recalculates statistics and updates the view. */
+    /** @brief Recalculates statistics on the database pool and updates the view when they arrive. */
     void refreshData();
 
+protected:
+    void showLoading(bool loading) override;
+
 private:
+    /**
+     * @struct ChartData
+     * @brief Every figure shown by the charts page, computed in one database round trip.
+     */
+    struct ChartData
+    {
+        Money income;                           ///< Income in the selected period.
+        Money expense;                          ///< Expenses in the selected period.
+        Money monthlyAverage;                   ///< All-time average monthly expense.
+        QMap<QString, double> expensesByCategory; ///< Category name -> expenses in the period.
+    };
+
     QPointer<ChartsView> view;
-    TransactionRepository& transactionRepository;
-    CategoryRepository& categoryRepository;
+    quint64 refreshGeneration = 0;  ///< Incremented per refresh; results of superseded refreshes are dropped.
 
+    /** @brief Runs on the database pool. Aggregates over the TransactionColumnStore, or in SQL if the profile could not be loaded into it. */
+    static ChartData loadChartData(int profileId, const QDate& start, const QDate& end);
 };
\ No newline at end of file
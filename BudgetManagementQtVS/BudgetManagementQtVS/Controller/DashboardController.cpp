@@ -3,23 +3,30 @@
  * @brief Implementation of the Dashboard Controller.
  */
 #include "Controller/DashboardController.h"
+#include "Diagnostics/Tracer.h"
+#include <QShortcut>
 
  /**
   * @brief Constructor. Creates the DashboardView and all sub-controllers (Transaction, Category, etc.).
   */
-DashboardController::DashboardController(ProfilesRepository& profileRepo, TransactionRepository& transactionRepo,
-    CategoryRepository& categoryRepo, FinancialAccountRepository& fAccRepo, QObject* parent)
+DashboardController::DashboardController(QObject* parent)
 {
     dashboardView = new DashboardView();
 
-    transactionController = new TransactionController(transactionRepo, categoryRepo, fAccRepo, profileRepo);
-    categoryController = new CategoryController(categoryRepo);
-    financialAccountController = new FinancialAccountController(fAccRepo);
-    chartsController = new ChartsController(transactionRepo, categoryRepo);
+    transactionController = new TransactionController();
+    categoryController = new CategoryController();
+    financialAccountController = new FinancialAccountController();
+    chartsController = new ChartsController();
     if (dashboardView) {
         dashboardView->setAttribute(Qt::WA_DeleteOnClose);
     	connect(dashboardView, &DashboardView::backToProfileRequested, this, &DashboardController::logoutRequested);
         setupConnections();
+
+#if BMA_TRACING_ENABLED
+        // Writes the trace collected so far without quitting.
+        QShortcut* traceShortcut = new QShortcut(QKeySequence(tr("Ctrl+Shift+T")), dashboardView);
+        connect(traceShortcut, &QShortcut::activated, this, []() { Tracer::instance().writeChromeTrace(); });
+#endif
     }
 }
 /** @brief Destructor closing the view. */
@@ -34,19 +41,23 @@ DashboardController::~DashboardController()
  * @brief Switches the central widget based on the selected page enum.
  * Calls run() on the target sub-controller before displaying its view.
  */
-void DashboardController::handlePageChange(DashboardView::SelectedPage page) const
+void DashboardController::handlePageChange(DashboardView::SelectedPage page)
 {
+    BMA_TRACE_SCOPE("controller", "DashboardController::handlePageChange");
+    BaseController* pageController = nullptr;
     switch (page) {
     case DashboardView::TransactionPage:
         if (transactionController) {
             transactionController->run();
             dashboardView->replaceCurrentWidget(page, transactionController->getView());
+            pageController = transactionController;
         }
         break;
     case DashboardView::CategoryPage:
         if (categoryController) {
             categoryController->run();
             dashboardView->replaceCurrentWidget(page, categoryController->getView());
+            pageController = categoryController;
         }
         break;
     case DashboardView::FinancialAccountPage:
@@ -54,6 +65,7 @@ void DashboardController::handlePageChange(DashboardView::SelectedPage page) con
         {
             financialAccountController->run();
             dashboardView->replaceCurrentWidget(page, financialAccountController->getView());
+            pageController = financialAccountController;
         }
         break;
     case DashboardView::ChartsPage:
@@ -61,15 +73,46 @@ void DashboardController::handlePageChange(DashboardView::SelectedPage page) con
         {
             chartsController->run();
             dashboardView->replaceCurrentWidget(page, chartsController->getView());
+            pageController = chartsController;
         }
         break;
     }
+    if (!pageController) return;
+
+    if (pageController->isLoading()) {
+        awaitedPage = page;
+    }
+    else {
+        awaitedPage.reset();
+        emit pageShown(page);
+    }
 }
 /** @brief Connects view signals to controller slots. */
 void DashboardController::setupConnections()
 {
     connect(dashboardView, &DashboardView::pageChangeRequested,
         this, &DashboardController::handlePageChange);
+
+    watchPageLoading(transactionController, DashboardView::TransactionPage);
+    watchPageLoading(categoryController, DashboardView::CategoryPage);
+    watchPageLoading(financialAccountController, DashboardView::FinancialAccountPage);
+    watchPageLoading(chartsController, DashboardView::ChartsPage);
+}
+/** @brief Loads finishing while another page is shown, or after the page was already reported, are ignored. */
+void DashboardController::watchPageLoading(BaseController* controller, DashboardView::SelectedPage page)
+{
+    if (!controller) return;
+
+    connect(controller, &BaseController::loadingFinished, this, [this, page]() {
+        if (awaitedPage != page) return;
+        awaitedPage.reset();
+        emit pageShown(page);
+        });
+}
+/** @brief Returns the dashboard view. */
+QPointer<DashboardView> DashboardController::getView() const
+{
+    return dashboardView;
 }
 /** @brief Shows the dashboard and defaults to Transaction page. */
 void DashboardController::run() {
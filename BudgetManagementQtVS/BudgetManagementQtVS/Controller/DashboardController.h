@@ -6,6 +6,7 @@
 #include "Controller/BaseController.h"
 #include "View/DashboardView.h"
 #include <QPointer>
+#include <optional>
 
 #include "Controller/CategorySelectionController.h"
 #include "Controller/ChartsController.h"
@@ -22,19 +23,25 @@ class DashboardController : public BaseController {
 
 public:
     /** @brief Constructs the DashboardController and initializes sub-controllers. */
-    explicit DashboardController(ProfilesRepository& profileRepo, TransactionRepository& transactionRepo, CategoryRepository& categoryRepo, FinancialAccountRepository& fAccRepo, QObject* parent = nullptr);
+    explicit DashboardController(QObject* parent = nullptr);
 
     /** @brief Starts the dashboard (shows view). */
     void run() override;
 
     ~DashboardController() override;
+
+    /** @brief Returns the dashboard view. */
+    QPointer<DashboardView> getView() const;
 signals:
     /** @brief Emitted when user wants to log out from the dashboard. */
     void logoutRequested();
 
+    /** @brief Emitted once a page selected in the side menu has loaded its data and updated its view. */
+    void pageShown(DashboardView::SelectedPage page);
+
 private slots:
     /** @brief Handles navigation requests from the side menu. */
-    void handlePageChange(DashboardView::SelectedPage page) const;
+    void handlePageChange(DashboardView::SelectedPage page);
 
 private:
     QPointer<DashboardView> dashboardView;
@@ -42,7 +49,11 @@ private:
     QPointer<CategoryController> categoryController;
     QPointer<FinancialAccountController> financialAccountController;
     QPointer<ChartsController> chartsController;
+    std::optional<DashboardView::SelectedPage> awaitedPage;    ///< Page whose controller is still loading after navigation.
 
     void setupConnections();
 
+    /** @brief Reports pageShown() for the page once its controller finishes loading after a navigation. */
+    void watchPageLoading(BaseController* controller, DashboardView::SelectedPage page);
+
 };
@@ -3,78 +3,16 @@
  * @brief Implementation of the Data Controller.
  */
 #include "Controller/DataController.h"
+#include "Model/CsvExporter.h"
+#include "Model/CsvImporter.h"
 #include <QFileDialog>
-#include <QFile>
-#include <QTextStream>
+#include <QProgressDialog>
 
  /** @brief Constructor. */
 DataController::DataController(ProfilesRepository& profileRepo, QObject* parent)
     : QObject(parent), profileRepository(profileRepo)
 {
 }
-/**
- * @brief Logic to fetch all user data (Profiles, Transactions) and write to CSV.
- */
-bool DataController::writeCsvToFile(int userId, const QString& filePath, QString& errorMessage)
-{
-    QFile file(filePath);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        errorMessage = "Could not open file for writing.";
-        return false;
-    }
-
-    QTextStream out(&file);
-    out << "Profile,Transaction ID,Name,Date,Description,Amount,Type,Category,Account,Account Type\n";
-
-    TransactionRepository transRepo;
-    CategoryRepository catRepo;
-    FinancialAccountRepository accountRepo;
-
-    QVector<Profile> profiles = profileRepository.getProfilesByUserId(userId);
-
-    auto escape = [](QString s) {
-        if (s.contains(',') || s.contains('"') || s.contains('\n')) {
-            s.replace("\"", "\"\"");
-            return "\"" + s + "\"";
-        }
-        return s;
-        };
-
-    for (const auto& profile : profiles) {
-        int profileId = profile.getProfileId();
-        QString profileName = profile.getProfileName();
-
-        QVector<Transaction> transactions = transRepo.getAllProfileTransaction(profileId);
-        QVector<FinancialAccount> accounts = accountRepo.getAllProfileFinancialAccounts(profileId);
-
-        for (const auto& trans : transactions) {
-            QString categoryName = catRepo.getCategoryNameById(trans.getCategoryId());
-            QString accountName = "Unknown";
-            QString accountType = "Unknown";
-
-            for (const auto& acc : accounts) {
-                if (acc.getFinancialAccountId() == trans.getFinancialAccountId()) {
-                    accountName = acc.getFinancialAccountName();
-                    accountType = acc.getFinancialAccountType();
-                    break;
-                }
-            }
-
-            out << escape(profileName) << ","
-                << trans.getTransactionId() << ","
-                << escape(trans.getTransactionName()) << ","
-                << trans.getTransactionDate().toString("yyyy-MM-dd") << ","
-                << escape(trans.getTransactionDescription()) << ","
-                << trans.getTransactionAmount() << ","
-                << escape(trans.getTransactionType()) << ","
-                << escape(categoryName) << ","
-                << escape(accountName) << ","
-                << escape(accountType) << "\n";
-        }
-    }
-    file.close();
-    return true;
-}
 /** @brief Shows file dialog and triggers CSV write. */
 void DataController::exportData(int userId, ProfileDialog* dialog)
 {
@@ -84,24 +22,50 @@ void DataController::exportData(int userId, ProfileDialog* dialog)
     if (fileName.isEmpty()) return;
 
     QString error;
-    if (writeCsvToFile(userId, fileName, error)) {
+    TransactionRepository transactionRepository;
+    if (CsvExporter::writeUserData(transactionRepository, userId, fileName, error)) {
         dialog->showProfileMessage(tr("Export Success"), tr("Data exported successfully."), "info");
     }
     else {
         dialog->showProfileMessage(tr("Export Error"), error, "error");
     }
 }
-/** @brief Triggers CSV write to a default autosave filename. */
-void DataController::autoSaveData(int userId)
+/** @brief Shows file dialog, streams the file through CsvImporter and reports the outcome. */
+bool DataController::importData(int userId, ProfileDialog* dialog)
 {
+    if (!dialog) return false;
 
-    QString fileName = QString("autosave_user_%1.csv").arg(userId);
+    QString fileName = QFileDialog::getOpenFileName(dialog, tr("Import Data"), "", tr("CSV Files (*.csv);;All Files (*)"));
+    if (fileName.isEmpty()) return false;
 
-    QString error;
-    if (writeCsvToFile(userId, fileName, error)) {
-        qDebug() << "Auto-save successful: " << fileName;
+    constexpr int progressSteps = 1000;
+    QProgressDialog progressDialog(tr("Importing transactions..."), tr("Cancel"), 0, progressSteps, dialog);
+    progressDialog.setWindowModality(Qt::WindowModal);
+    progressDialog.setMinimumDuration(500);
+
+    CsvImporter importer(profileRepository, userId);
+    const CsvImporter::Result result = importer.importFile(fileName,
+        [&progressDialog](qint64 bytesRead, qint64 totalBytes, int rowsImported) {
+            if (totalBytes > 0) {
+                progressDialog.setValue(static_cast<int>(bytesRead * progressSteps / totalBytes));
+            }
+            progressDialog.setLabelText(tr("Importing transactions... %1 rows").arg(rowsImported));
+            return !progressDialog.wasCanceled();
+        });
+    progressDialog.reset();
+
+    if (!result.fatalError.isEmpty()) {
+        dialog->showProfileMessage(tr("Import Error"), result.fatalError, "error");
+        return false;
     }
-    else {
-        qDebug() << "Auto-save failed: " << error;
+
+    QString message = result.cancelled
+        ? tr("Import cancelled. %1 rows were imported before cancelling.").arg(result.importedCount)
+        : tr("%1 rows imported.").arg(result.importedCount);
+    if (result.rejectedCount > 0) {
+        message += "\n" + tr("%1 rows were skipped:").arg(result.rejectedCount) + "\n" + result.errors.join("\n");
+        if (result.errors.size() < result.rejectedCount) message += "\n...";
     }
-}
\ No newline at end of file
+    dialog->showProfileMessage(tr("Import Finished"), message, "info");
+    return result.importedCount > 0;
+}
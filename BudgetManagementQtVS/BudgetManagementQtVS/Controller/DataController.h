@@ -13,7 +13,7 @@
 
  /**
   * @class DataController
-  * @brief Handles data export operations (e.g., CSV export).
+  * @brief Handles data export and import operations (e.g., CSV export).
   */
 class DataController : public QObject
 {
@@ -29,19 +29,14 @@ public:
     void exportData(int userId, ProfileDialog* dialog);
 
     /**
-     * @brief Automatically saves data to a predefined file (e.g., on exit).
-     * @param userId The user ID to save data for.
+     * @brief Imports a CSV file in the export format (Open File Dialog), with a cancellable progress dialog.
+     * Profiles, categories and accounts named in the file are created for the user if missing.
+     * @param userId The user ID to import data for.
+     * @param dialog Parent widget for the dialogs.
+     * @return True if at least one row was imported.
      */
-    void autoSaveData(int userId);
+    bool importData(int userId, ProfileDialog* dialog);
 
 private:
     ProfilesRepository& profileRepository;
-    /**
-     * @brief Internal helper to write database content to a CSV file.
-     * @param userId Target user ID.
-     * @param filePath Path to output file.
-     * @param errorMessage Output parameter for error strings.
-     * @return True if successful.
-     */
-    bool writeCsvToFile(int userId, const QString& filePath, QString& errorMessage);
 };
\ No newline at end of file
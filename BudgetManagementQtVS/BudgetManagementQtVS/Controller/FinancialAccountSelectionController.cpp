@@ -3,6 +3,7 @@
  * @brief Implementation of the Financial Account Controller.
  */
 #include <Controller/FinancialAccountSelectionController.h>
+#include "Diagnostics/Tracer.h"
 #include <QInputDialog>
 #include <QMessageBox>
 #include <algorithm>
@@ -14,8 +15,8 @@
 #include <QLineEdit>
 
  /** @brief Constructor. Initializes view and connections. */
-FinancialAccountController::FinancialAccountController(FinancialAccountRepository& repoRef, QObject* parent)
-    : BaseController(parent), financialAccountRepository(repoRef)
+FinancialAccountController::FinancialAccountController(QObject* parent)
+    : BaseController(parent)
 {
     fAccountView = new FinancialAccountSelectionView();
     if (fAccountView) {
@@ -55,49 +56,82 @@ void FinancialAccountController::setupFinancialAccountWindow()
     connect(fAccountView, &FinancialAccountSelectionView::searchAccountRequest, this, &FinancialAccountController::handleFinancialAccountFilteringRequest);
     connect(fAccountView, &FinancialAccountSelectionView::columnSortRequest, this, &FinancialAccountController::handleSortingRequest);
 }
-/** @brief Refreshes table with data from repository. */
+/** @brief Forwards the loading state to the view. */
+void FinancialAccountController::showLoading(bool loading)
+{
+    if (fAccountView) fAccountView->setLoading(loading);
+}
+/** @brief Refreshes table with data queried on the database pool. */
 void FinancialAccountController::refreshTable()
 {
-    QVector<FinancialAccount> accounts = financialAccountRepository.getAllProfileFinancialAccounts(getUserId()); 
+    BMA_TRACE_SCOPE("controller", "FinancialAccountController::refreshTable");
+    const int userId = getUserId();
+    const quint64 generation = ++refreshGeneration;
+
+    beginLoading();
+    AsyncRepository::instance().financialAccounts([userId](const FinancialAccountRepository& repository) {
+        return repository.getAllProfileFinancialAccounts(userId);
+        }).then(this, [this, generation](QVector<FinancialAccount> accounts) {
+            BMA_TRACE_SCOPE("controller", "FinancialAccountController::refreshTable.result");
+            endLoading();
+            if (generation != refreshGeneration || !fAccountView) return;
+
+            loadedAccounts = std::move(accounts);
+            updateTable();
+            emit financialAccountDataChanged();
+            });
+}
+/** @brief Applies filter/sort to the cached accounts and updates the view. */
+void FinancialAccountController::updateTable()
+{
+    BMA_TRACE_SCOPE("controller", "FinancialAccountController::updateTable");
+    QVector<FinancialAccount> accounts = loadedAccounts;
 
     if (!getFilteringText().isEmpty()) accounts = executeFilteringFinancialAccount(accounts);
     executeSortingFinancialAccount(accounts);
 
-    QVector<QStringList> viewData;
-    for (const auto& acc : accounts) {
-        QStringList row;
-        row << QString::number(acc.getFinancialAccountId());
-        row << acc.getFinancialAccountName();
-        row << acc.getFinancialAccountType();
-        row << QString::number(acc.getFinancialAccountBalance(), 'f', 2) + " PLN";
-        row << QString::number(acc.getFinancialAccountCurrentBalance(), 'f', 2) + " PLN";
-        viewData.append(row);
-    }
-    fAccountView->setAccountTabHeaders(viewData);
-    emit financialAccountDataChanged();
+    fAccountView->setAccounts(std::move(accounts));
 }
 
 // CRUD Logic implementations
 void FinancialAccountController::handleFinancialAccountAddRequest(const QString& name, const QString& type, double balance)
 {
-    if (financialAccountRepository.addFinancialAccount(name, type, balance, getProfileId())) {
-        fAccountView->showMessage("Success", "Account added.", "info");
-        refreshTable();
-    }
-    else {
-        fAccountView->showMessage("Error", "Failed to add account.", "error");
-    }
+    const int profileId = getProfileId();
+
+    beginLoading();
+    AsyncRepository::instance().financialAccounts([name, type, balance, profileId](const FinancialAccountRepository& repository) {
+        return repository.addFinancialAccount(name, type, Money::fromDouble(balance), profileId);
+        }).then(this, [this](bool added) {
+            endLoading();
+            if (!fAccountView) return;
+
+            if (added) {
+                fAccountView->showMessage("Success", "Account added.", "info");
+                refreshTable();
+            }
+            else {
+                fAccountView->showMessage("Error", "Failed to add account.", "error");
+            }
+            });
 }
 
 void FinancialAccountController::handleFinancialAccountEditRequest(int id, const QString& name, const QString& type, double balance)
 {
-    if (financialAccountRepository.updateFinancialAccount(id, name, type, balance)) {
-        fAccountView->showMessage("Success", "Updated.", "info");
-        refreshTable();
-    }
-    else {
-        fAccountView->showMessage("Error", "Failed to update.", "error");
-    }
+    beginLoading();
+    AsyncRepository::instance().financialAccounts([id, name, type, balance](const FinancialAccountRepository& repository) {
+        return repository.updateFinancialAccount(id, name, type, Money::fromDouble(balance));
+        }).then(this, [this](bool updated) {
+            endLoading();
+            if (!fAccountView) return;
+
+            if (updated) {
+                fAccountView->showMessage("Success", "Updated.", "info");
+                refreshTable();
+            }
+            else {
+                fAccountView->showMessage("Error", "Failed to update.", "error");
+            }
+            });
 }
 
 void FinancialAccountController::handleFinancialAccountDeleteRequest(int id)
@@ -106,25 +140,35 @@ void FinancialAccountController::handleFinancialAccountDeleteRequest(int id)
         fAccountView->showMessage("Error", "Cannot delete default account.", "error");
         return;
     }
-    if (financialAccountRepository.removeFinancialAccount(id)) {
-        fAccountView->showMessage("Success", "Deleted.", "info");
-        refreshTable();
-    }
-    else {
-        fAccountView->showMessage("Error", "Failed to delete.", "error");
-    }
+    beginLoading();
+    AsyncRepository::instance().financialAccounts([id](const FinancialAccountRepository& repository) {
+        return repository.removeFinancialAccount(id);
+        }).then(this, [this](bool removed) {
+            endLoading();
+            if (!fAccountView) return;
+
+            if (removed) {
+                fAccountView->showMessage("Success", "Deleted.", "info");
+                // The account's transactions moved to the default account, whose balance changed too.
+                refreshTable();
+                emit financialAccountDataChanged();
+            }
+            else {
+                fAccountView->showMessage("Error", "Failed to delete.", "error");
+            }
+            });
 }
 // Filter & Sort implementations
 void FinancialAccountController::handleFinancialAccountFilteringRequest(const QString& text)
 {
     setFilteringText(text);
-    refreshTable();
+    updateTable();
 }
 
 void FinancialAccountController::handleSortingRequest(int columnId)
 {
     setSelectedColumnId(columnId);
-    refreshTable();
+    updateTable();
 }
 
 QVector<FinancialAccount> FinancialAccountController::executeFilteringFinancialAccount(const QVector<FinancialAccount> allAccounts)
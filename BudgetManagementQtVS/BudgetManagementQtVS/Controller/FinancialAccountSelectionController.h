@@ -4,7 +4,7 @@
  */
 #pragma once
 
-#include <Model/Repositories/FinancialAccountRepository.h>
+#include <Model/Repositories/AsyncRepository.h>
 #include <Model/FinancialAccount.h>
 #include <Model/TransactionBuilder.h>
 
@@ -27,11 +27,10 @@ class FinancialAccountController : public BaseController
 
 public:
     /**
-     * @brief Constructs the controller.
-     * @param repoRef Reference to the financial account repository.
+     * @brief Constructs the controller. Accounts are queried on the database pool.
      * @param parent Parent QObject.
      */
-    FinancialAccountController(FinancialAccountRepository& repoRef, QObject* parent = nullptr);
+    explicit FinancialAccountController(QObject* parent = nullptr);
 
     /** @brief Starts the controller logic (refreshes the table). */
     void run();
@@ -82,13 +81,19 @@ public slots:
      */
     void handleSortingRequest(int columnId);
 
+protected:
+    void showLoading(bool loading) override;
+
 private:
     QPointer<FinancialAccountSelectionView> fAccountView; 
-    FinancialAccountRepository& financialAccountRepository;
 
     int selectedFinancialAccountIdForTransaction = 1;
+    QVector<FinancialAccount> loadedAccounts;   ///< Last query result; filtering and sorting reuse it.
+    quint64 refreshGeneration = 0;              ///< Results of superseded refreshes are dropped.
 
     void refreshTable();
+    /** @brief Applies the current filter and sort to loadedAccounts and shows the result. */
+    void updateTable();
     QVector<FinancialAccount> executeFilteringFinancialAccount(const QVector<FinancialAccount> allAccounts);
     void executeSortingFinancialAccount(QVector<FinancialAccount>& allAccounts);
     void executeSortingFinancialAccount(QVector<FinancialAccount>& allAccounts) const;
@@ -32,6 +32,8 @@ ProfileController::ProfileController(ProfilesRepository& profileRepositoryRef, Q
         this, &ProfileController::handleLogoutRequest);
     connect(profileDialog, &ProfileDialog::exportDataRequested,
         this, &ProfileController::handleExportDataRequest);
+    connect(profileDialog, &ProfileDialog::importDataRequested,
+        this, &ProfileController::handleImportDataRequest);
 }
 
 /** @brief Runs the controller. */
@@ -133,3 +135,16 @@ void ProfileController::handleExportDataRequest() const
 
     dataController->exportData(getUserId(), profileDialog);
 }
+/** @brief Delegates import to DataController and reloads the profile list, which the import may have extended. */
+void ProfileController::handleImportDataRequest()
+{
+    if (!profileDialog || !dataController)
+    {
+        return;
+    }
+
+    if (dataController->importData(getUserId(), profileDialog))
+    {
+        profileDialog->setProfiles(profileRepository.getProfilesByUserId(getUserId()));
+    }
+}
@@ -74,5 +74,7 @@ private:
     void handleLogoutRequest();
 
     void handleExportDataRequest() const;
+
+    void handleImportDataRequest();
 };
 
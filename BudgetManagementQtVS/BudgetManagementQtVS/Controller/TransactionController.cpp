@@ -3,13 +3,14 @@
  * @brief Implementation of the Transaction Controller.
  */
 #include "Controller/TransactionController.h"
+#include "Diagnostics/Tracer.h"
 #include <QInputDialog> 
+#include <optional>
+#include <utility>
 
  /** @brief Constructor. Initializes view and connects signals. */
-TransactionController::TransactionController(TransactionRepository& transactionRepositoryRef, CategoryRepository& categoryRepositoryRef, FinancialAccountRepository& financialAccountRepositoryRef, ProfilesRepository& profileRepositoryRef, QObject* parent)
-	: BaseController(parent), transactionRepository(transactionRepositoryRef),
-	  categoryRepository(categoryRepositoryRef), financialAccountRepository(financialAccountRepositoryRef),
-	  profileRepository(profileRepositoryRef)
+TransactionController::TransactionController(QObject* parent)
+	: BaseController(parent)
 {
 	transactionView = new TransactionWindow();
 	
@@ -26,6 +27,8 @@ TransactionController::TransactionController(TransactionRepository& transactionR
 	            this, &TransactionController::handleFilteringTransactionRequest);
 	        connect(transactionView, &TransactionWindow::columnSortRequest,
 	            this, &TransactionController::handleSortingRequest);
+	        connect(transactionView, &TransactionWindow::moreTransactionsRequested,
+	            this, &TransactionController::loadNextPage);
 	    }
 }
 /** @brief Runs the controller (refreshes data). */
@@ -38,85 +41,213 @@ QWidget* TransactionController::getView()
 {
     return transactionView;
 }
-/** @brief Fetches transactions, applies filter/sort, updates table and budget. */
+/** @brief Forwards the loading state to the view. */
+void TransactionController::showLoading(bool loading)
+{
+    if (transactionView) transactionView->setLoading(loading);
+}
+/** @brief Restarts the transaction listing and updates the budget. */
 void TransactionController::refreshTransactionsView()
 {
+    BMA_TRACE_SCOPE("controller", "TransactionController::refreshTransactionsView");
     if (!transactionView || getProfileId() < 0) return;
-    QVector<Transaction> allTransactions = transactionRepository.getAllProfileTransaction(getProfileId());
-
-    allTransactions = executeFilteringTransaction(allTransactions);
-    executeSortingTransaction(allTransactions);
-
-    QVector<QStringList> tableRows;
-    for (const auto& transaction : allTransactions) {
-        QStringList rowData;
-        rowData << QString::number(transaction.getTransactionId())
-            << transaction.getTransactionName()
-            << transaction.getTransactionDate().toString("yyyy-MM-dd")
-            << transaction.getTransactionDescription()
-            << QString::number(transaction.getTransactionAmount(), 'f', 2)
-            << transaction.getTransactionType()
-            << categoryRepository.getCategoryNameById(transaction.getCategoryId())
-            << financialAccountRepository.getFinancialAccountNameById(transaction.getFinancialAccountId());
-        tableRows.append(rowData);
+
+    reloadTransactionList();
+    refreshBudgetDisplay();
+}
+/** @brief Maps grid columns (ID, Name, Date, Description, Amount, Type, Category, Account) to orderings. */
+TransactionRepository::SortColumn TransactionController::sortColumnFor(int columnId)
+{
+    switch (columnId) {
+    case 1:
+        return TransactionRepository::SortColumn::Name;
+    case 2:
+        return TransactionRepository::SortColumn::Date;
+    case 4:
+        return TransactionRepository::SortColumn::Amount;
+    case 6:
+        return TransactionRepository::SortColumn::Category;
+    case 7:
+        return TransactionRepository::SortColumn::Account;
+    default:
+        return TransactionRepository::SortColumn::Id;
     }
-    transactionView->setTransactionTabHeaders(tableRows);
+}
 
-    QDate current = QDate::currentDate();
-    double budgetLimit = profileRepository.getBudgetLimit(getProfileId());
-    double monthlySpent = transactionRepository.getMonthlyExpenses(getProfileId(), current.month(), current.year());
+TransactionRepository::PageRequest TransactionController::currentPageRequest()
+{
+    TransactionRepository::PageRequest request;
+    request.profileId = getProfileId();
+    request.sortColumn = sortColumnFor(getSelectedColumnId());
+    request.order = getLastSortingOrder();
+    request.filter = getFilteringText();
+    request.pageSize = pageSize;
+    return request;
+}
+/**
+ * @brief Fetches the first page; any page still in flight for the previous listing is dropped on arrival.
+ * The cursor is cleared up front so a fetchMore arriving before the first page cannot continue the old listing.
+ */
+void TransactionController::reloadTransactionList()
+{
+    BMA_TRACE_SCOPE("controller", "TransactionController::reloadTransactionList");
+    if (!transactionView || getProfileId() < 0) return;
 
-    transactionView->updateBudgetDisplay(budgetLimit, monthlySpent);
+    const TransactionRepository::PageRequest request = currentPageRequest();
+    const quint64 generation = ++listingGeneration;
+    nextPageCursor = {};
+
+    beginLoading();
+    AsyncRepository::instance().transactions([request](const TransactionRepository& repository) {
+        return repository.getTransactionPage(request);
+        }).then(this, [this, generation](TransactionRepository::Page page) {
+            BMA_TRACE_SCOPE("controller", "TransactionController::reloadTransactionList.result");
+            endLoading();
+            if (generation != listingGeneration || !transactionView) return;
+
+            nextPageCursor = page.next;
+            transactionView->setTransactions(std::move(page.rows), page.hasMore);
+            });
 }
-/** @brief Opens dialog to add transaction, handles creation logic. */
+/** @brief Called by the view when the user scrolls past the last row; the model asks at most once per page. */
+void TransactionController::loadNextPage()
+{
+    BMA_TRACE_SCOPE("controller", "TransactionController::loadNextPage");
+    if (!transactionView || !nextPageCursor.isValid()) return;
+
+    TransactionRepository::PageRequest request = currentPageRequest();
+    request.after = nextPageCursor;
+    const quint64 generation = listingGeneration;
+
+    beginLoading();
+    AsyncRepository::instance().transactions([request](const TransactionRepository& repository) {
+        return repository.getTransactionPage(request);
+        }).then(this, [this, generation](TransactionRepository::Page page) {
+            BMA_TRACE_SCOPE("controller", "TransactionController::loadNextPage.result");
+            endLoading();
+            if (generation != listingGeneration || !transactionView) return;
+
+            if (!page.ok) {
+                transactionView->appendTransactions({}, false);
+                return;
+            }
+            if (!page.rows.isEmpty()) nextPageCursor = page.next;
+            transactionView->appendTransactions(std::move(page.rows), page.hasMore);
+            });
+}
+/** @brief Recomputes this month's spending against the profile budget limit; the spending is summed over the TransactionColumnStore. */
+void TransactionController::refreshBudgetDisplay()
+{
+    BMA_TRACE_SCOPE("controller", "TransactionController::refreshBudgetDisplay");
+    if (!transactionView || getProfileId() < 0) return;
+
+    const int profileId = getProfileId();
+    const QDate current = QDate::currentDate();
+    const quint64 generation = ++budgetGeneration;
+
+    beginLoading();
+    AsyncRepository::instance().run([profileId, current]() {
+        ProfilesRepository profileRepository;
+        TransactionRepository transactionRepository;
+        const QDate monthStart(current.year(), current.month(), 1);
+        Money monthlySpent;
+        if (!transactionRepository.loadColumnStore(profileId) || !TransactionColumnStore::instance()
+            .sumByTypeAndDate(profileId, TransactionType::Expense, monthStart, monthStart.addMonths(1).addDays(-1), monthlySpent)) {
+            monthlySpent = transactionRepository.getMonthlyExpenses(profileId, current.month(), current.year());
+        }
+        return BudgetStatus{ profileRepository.getBudgetLimit(profileId), monthlySpent };
+        }).then(this, [this, generation](BudgetStatus status) {
+            BMA_TRACE_SCOPE("controller", "TransactionController::refreshBudgetDisplay.result");
+            endLoading();
+            if (generation != budgetGeneration || !transactionView) return;
+
+            transactionView->updateBudgetDisplay(status.limit.toDouble(), status.monthlySpent.toDouble());
+            });
+}
+/** @brief Loads categories and accounts of a profile for the editor dialog. */
+TransactionController::EditorChoices TransactionController::loadEditorChoices(int profileId)
+{
+    CategoryRepository categoryRepository;
+    FinancialAccountRepository financialAccountRepository;
+    return EditorChoices{ categoryRepository.getAllProfileCategories(profileId),
+        financialAccountRepository.getAllProfileFinancialAccounts(profileId) };
+}
+/**
+ * @brief Adds a category or account requested from inside the editor and reloads the dialog's list.
+ * Continuations use the dialog as context, so they are dropped if it was closed in the meantime.
+ */
+void TransactionController::connectEditorRequests(TransactionEditorDialogView& dialog)
+{
+    const int profileId = getProfileId();
+    TransactionEditorDialogView* editor = &dialog;
+
+    connect(editor, &TransactionEditorDialogView::addCategoryRequested, this,
+        [this, editor, profileId](const QString& name) {
+            AsyncRepository::instance().categories([name, profileId](const CategoryRepository& repository) {
+                if (!repository.addCategory(name, profileId)) return std::optional<QVector<Category>>();
+                return std::optional<QVector<Category>>(repository.getAllProfileCategories(profileId));
+                }).then(editor, [this, editor, name](std::optional<QVector<Category>> newCats) {
+                    if (!newCats) {
+                        if (transactionView) transactionView->showTransactionMessage("Error", "Failed to add category", "error");
+                        return;
+                    }
+
+                    int newId = -1;
+                    for (const auto& c : *newCats) if (c.getCategoryName() == name) newId = c.getCategoryId();
+
+                    editor->refreshCategories(*newCats, newId);
+                    });
+        });
+
+    connect(editor, &TransactionEditorDialogView::addFinancialAccountRequested, this,
+        [this, editor, profileId](const QString& name, const QString& type, double balance) {
+            AsyncRepository::instance().financialAccounts([name, type, balance, profileId](const FinancialAccountRepository& repository) {
+                if (!repository.addFinancialAccount(name, type, Money::fromDouble(balance), profileId)) return std::optional<QVector<FinancialAccount>>();
+                return std::optional<QVector<FinancialAccount>>(repository.getAllProfileFinancialAccounts(profileId));
+                }).then(editor, [this, editor, name](std::optional<QVector<FinancialAccount>> newAccs) {
+                    if (!newAccs) {
+                        if (transactionView) transactionView->showTransactionMessage("Error", "Failed to add account", "error");
+                        return;
+                    }
+
+                    int newId = -1;
+                    for (const auto& a : *newAccs) if (a.getFinancialAccountName() == name) newId = a.getFinancialAccountId();
+
+                    editor->refreshFinancialAccounts(*newAccs, newId);
+                    });
+        });
+}
+/** @brief Loads the editor's choices, then opens the dialog to add a transaction. */
 void TransactionController::handleAddTransactionRequest()
 {
     if (getProfileId() < 0) {return;}
 
-    QVector<Category> categories = categoryRepository.getAllProfileCategories(getProfileId());
-    QVector<FinancialAccount> accounts = financialAccountRepository.getAllProfileFinancialAccounts(getProfileId());
+    const int profileId = getProfileId();
+
+    beginLoading();
+    AsyncRepository::instance().run([profileId]() {
+        return loadEditorChoices(profileId);
+        }).then(this, [this](EditorChoices choices) {
+            endLoading();
+            openAddDialog(choices);
+            });
+}
+/** @brief Opens dialog to add transaction, handles creation logic. */
+void TransactionController::openAddDialog(const EditorChoices& choices)
+{
+    if (!transactionView) return;
 
-    if (accounts.isEmpty()) {
+    if (choices.accounts.isEmpty()) {
         transactionView->showTransactionMessage(tr("Warning"), tr("You need to add a Financial Account first!"), "error");
         return;
     }
 
     TransactionEditorDialogView dialog(transactionView);
-    dialog.setCategories(categories);
-    dialog.setFinancialAccounts(accounts);
+    dialog.setCategories(choices.categories);
+    dialog.setFinancialAccounts(choices.accounts);
     dialog.setTransactionTypes();
 
-    connect(&dialog, &TransactionEditorDialogView::addCategoryRequested, this,
-        [&](const QString& name) {
-            if (categoryRepository.addCategory(name, getProfileId())) {
-
-                QVector<Category> newCats = categoryRepository.getAllProfileCategories(getProfileId());
-
-                int newId = -1;
-                for (const auto& c : newCats) if (c.getCategoryName() == name) newId = c.getCategoryId();
-
-                dialog.refreshCategories(newCats, newId);
-            }
-            else {
-                transactionView->showTransactionMessage("Error", "Failed to add category", "error");
-            }
-        });
-
-    connect(&dialog, &TransactionEditorDialogView::addFinancialAccountRequested, this,
-        [&](const QString& name, const QString& type, double balance) {
-            if (financialAccountRepository.addFinancialAccount(name, type, balance, getProfileId())) {
-                QVector<FinancialAccount> newAccs = financialAccountRepository.getAllProfileFinancialAccounts(getProfileId());
-
-   
-                int newId = -1;
-                for (const auto& a : newAccs) if (a.getFinancialAccountName() == name) newId = a.getFinancialAccountId();
-
-                dialog.refreshFinancialAccounts(newAccs, newId);
-            }
-            else {
-                transactionView->showTransactionMessage("Error", "Failed to add account", "error");
-            }
-        });
+    connectEditorRequests(dialog);
 
     if (dialog.exec() == QDialog::Accepted) {
         QString name = dialog.getName();
@@ -128,24 +259,32 @@ void TransactionController::handleAddTransactionRequest()
         TransactionBuilder builder;
         builder.withProfileId(getProfileId())
             .withName(name)
-            .withAmount(dialog.getAmount())
+            .withAmount(Money::fromDouble(dialog.getAmount()))
             .withDate(dialog.getDate())
             .withDescription(dialog.getDescription())
             .withCategoryId(dialog.getSelectedCategoryId())
-            .withType(dialog.getType())
+            .withType(TransactionTypes::fromName(dialog.getType()))
             .withFinancialAccountId(dialog.getSelectedFinancialAccountId());
 
         Transaction newTransaction = builder.build();
 
-        if (transactionRepository.addTransaction(newTransaction)) {
-            refreshTransactionsView();
-        }
-        else {
-            transactionView->showTransactionMessage(tr("Error"), tr("Failed to add transaction to database."), "error");
-        }
+        beginLoading();
+        AsyncRepository::instance().transactions([newTransaction](const TransactionRepository& repository) {
+            return repository.addTransaction(newTransaction);
+            }).then(this, [this](bool added) {
+                endLoading();
+                if (!transactionView) return;
+
+                if (added) {
+                    refreshTransactionsView();
+                }
+                else {
+                    transactionView->showTransactionMessage(tr("Error"), tr("Failed to add transaction to database."), "error");
+                }
+                });
     }
 }
-/** @brief Opens dialog to edit selected transaction. */
+/** @brief Loads the selected transaction and the editor's choices, then opens the edit dialog. */
 void TransactionController::handleEditTransactionRequest()
 {
     int transactionId = transactionView->getSelectedTransactionId();
@@ -154,55 +293,39 @@ void TransactionController::handleEditTransactionRequest()
         return;
     }
 
-    Transaction currentTrans = transactionRepository.getTransactionById(transactionId);
-    if (currentTrans.getTransactionId() == -1) return;
-
-    QVector<Category> categories = categoryRepository.getAllProfileCategories(getProfileId());
-    QVector<FinancialAccount> accounts = financialAccountRepository.getAllProfileFinancialAccounts(getProfileId());
+    const int profileId = getProfileId();
+
+    beginLoading();
+    AsyncRepository::instance().run([transactionId, profileId]() {
+        TransactionRepository transactionRepository;
+        return std::make_pair(transactionRepository.getTransactionById(transactionId), loadEditorChoices(profileId));
+        }).then(this, [this](std::pair<Transaction, EditorChoices> loaded) {
+            endLoading();
+            if (loaded.first.getTransactionId() == -1) return;
+            openEditDialog(loaded.first, loaded.second);
+            });
+}
+/** @brief Opens dialog to edit selected transaction. */
+void TransactionController::openEditDialog(const Transaction& currentTrans, const EditorChoices& choices)
+{
+    if (!transactionView) return;
 
     TransactionEditorDialogView dialog(transactionView);
     dialog.setWindowTitle(tr("Edit Transaction"));
 
-    dialog.setCategories(categories);
-    dialog.setFinancialAccounts(accounts);
+    dialog.setCategories(choices.categories);
+    dialog.setFinancialAccounts(choices.accounts);
     dialog.setTransactionTypes();
 
     dialog.setName(currentTrans.getTransactionName());
-    dialog.setAmount(currentTrans.getTransactionAmount());
+    dialog.setAmount(currentTrans.getTransactionAmount().toDouble());
     dialog.setDate(currentTrans.getTransactionDate());
-    dialog.setType(currentTrans.getTransactionType());
+    dialog.setType(TransactionTypes::toString(currentTrans.getTransactionType()));
     dialog.setDescription(currentTrans.getTransactionDescription());
     dialog.setSelectedCategoryId(currentTrans.getCategoryId());
     dialog.setSelectedFinancialAccountId(currentTrans.getFinancialAccountId());
 
-    connect(&dialog, &TransactionEditorDialogView::addCategoryRequested, this,
-        [&](const QString& name) {
-            if (categoryRepository.addCategory(name, getProfileId())) {
-                QVector<Category> newCats = categoryRepository.getAllProfileCategories(getProfileId());
-
-                int newId = -1;
-                for (const auto& c : newCats) if (c.getCategoryName() == name) newId = c.getCategoryId();
-
-                dialog.refreshCategories(newCats, newId);
-            }
-            else {
-                transactionView->showTransactionMessage("Error", "Failed to add category", "error");
-            }
-        });
-    connect(&dialog, &TransactionEditorDialogView::addFinancialAccountRequested, this,
-        [&](const QString& name, const QString& type, double balance) {
-            if (financialAccountRepository.addFinancialAccount(name, type, balance, getProfileId())) {
-                QVector<FinancialAccount> newAccs = financialAccountRepository.getAllProfileFinancialAccounts(getProfileId());
-
-                int newId = -1;
-                for (const auto& a : newAccs) if (a.getFinancialAccountName() == name) newId = a.getFinancialAccountId();
-
-                dialog.refreshFinancialAccounts(newAccs, newId);
-            }
-            else {
-                transactionView->showTransactionMessage("Error", "Failed to add account", "error");
-            }
-        });
+    connectEditorRequests(dialog);
 
     if (dialog.exec() == QDialog::Accepted) {
         QString name = dialog.getName();
@@ -215,8 +338,8 @@ void TransactionController::handleEditTransactionRequest()
         builder.withId(currentTrans.getTransactionId())
             .withProfileId(getProfileId())
             .withName(name)
-            .withAmount(dialog.getAmount())
-            .withType(dialog.getType())
+            .withAmount(Money::fromDouble(dialog.getAmount()))
+            .withType(TransactionTypes::fromName(dialog.getType()))
             .withDate(dialog.getDate())
             .withDescription(dialog.getDescription())
             .withCategoryId(dialog.getSelectedCategoryId())
@@ -224,12 +347,22 @@ void TransactionController::handleEditTransactionRequest()
 
         Transaction updatedTransaction = builder.build();
 
-        if (transactionRepository.updateTransaction(updatedTransaction)) {
-            refreshTransactionsView();
-        }
-        else {
-            transactionView->showTransactionMessage(tr("Error"), tr("Failed to update transaction."), "error");
-        }
+        beginLoading();
+        AsyncRepository::instance().transactions([updatedTransaction](const TransactionRepository& repository) {
+            return repository.updateTransaction(updatedTransaction);
+            }).then(this, [this](bool updated) {
+                endLoading();
+                if (!transactionView) return;
+
+                if (updated) {
+                    // The edited row may no longer match the filter or may belong elsewhere in the sort order.
+                    reloadTransactionList();
+                    refreshBudgetDisplay();
+                }
+                else {
+                    transactionView->showTransactionMessage(tr("Error"), tr("Failed to update transaction."), "error");
+                }
+                });
     }
 }
 /** @brief Deletes selected transaction. */
@@ -241,76 +374,58 @@ void TransactionController::handleDeleteTransactionRequest()
         return;
     }
 
-    if (!transactionRepository.removeTransactionById(transactionId))
-    {
-        transactionView->showTransactionMessage(tr("Delete"), tr("Failed to delete transaction."), "error");
-        return;
-    }
-    refreshTransactionsView();
+    beginLoading();
+    AsyncRepository::instance().transactions([transactionId](const TransactionRepository& repository) {
+        return repository.removeTransactionById(transactionId);
+        }).then(this, [this, transactionId](bool removed) {
+            endLoading();
+            if (!transactionView) return;
+
+            if (!removed)
+            {
+                transactionView->showTransactionMessage(tr("Delete"), tr("Failed to delete transaction."), "error");
+                return;
+            }
+            transactionView->removeTransaction(transactionId);
+            refreshBudgetDisplay();
+            });
 }
-/** @brief Updates monthly budget limit. */
+/** @brief Loads the current limit, asks for a new one and stores it. */
 void TransactionController::handleEditBudgetRequest()
 {
-    bool ok;
-    double currentLimit = profileRepository.getBudgetLimit(getProfileId());
-    double newLimit = QInputDialog::getDouble(transactionView, tr("Budget"),
-        tr("Set Monthly Budget Limit (PLN):"),
-        currentLimit, 0, 1000000, 2, &ok);
-    if (ok) {
-        profileRepository.setBudgetLimit(getProfileId(), newLimit);
-        refreshTransactionsView();
-    }
+    const int profileId = getProfileId();
+
+    beginLoading();
+    AsyncRepository::instance().profiles([profileId](const ProfilesRepository& repository) {
+        return repository.getBudgetLimit(profileId);
+        }).then(this, [this, profileId](Money currentLimit) {
+            endLoading();
+            if (!transactionView) return;
+
+            bool ok;
+            double newLimit = QInputDialog::getDouble(transactionView, tr("Budget"),
+                tr("Set Monthly Budget Limit (PLN):"),
+                currentLimit.toDouble(), 0, 1000000, 2, &ok);
+            if (!ok) return;
+
+            beginLoading();
+            AsyncRepository::instance().profiles([profileId, newLimit](const ProfilesRepository& repository) {
+                return repository.setBudgetLimit(profileId, Money::fromDouble(newLimit));
+                }).then(this, [this](bool) {
+                    endLoading();
+                    refreshBudgetDisplay();
+                    });
+            });
 }
-/** @brief Method that sets up filtering text and calls refresh view method where filtering occurs. */
+/** @brief Stores the search text and restarts the listing with it. */
 void TransactionController::handleFilteringTransactionRequest(QString searchText)
 {
     setFilteringText(searchText);
-    refreshTransactionsView();
-}
-/** @brief An actual method for handling filtering specific transactions. */
-QVector<Transaction> TransactionController::executeFilteringTransaction(const QVector<Transaction> allTransactions)
-{
-    return executeFiltering(allTransactions, [this](const Transaction& t) {
-        QString filter = getFilteringText();
-
-        bool nameMatches = t.getTransactionName().contains(filter, Qt::CaseInsensitive);
-        bool descriptionMatches = t.getTransactionDescription().contains(filter, Qt::CaseInsensitive);
-        bool typeMatches = t.getTransactionType().contains(filter, Qt::CaseInsensitive);
-
-        bool categoryMatches = categoryRepository.getCategoryNameById(t.getCategoryId()).contains(filter, Qt::CaseInsensitive);
-        bool financialAccountMatches = financialAccountRepository.getFinancialAccountNameById(t.getFinancialAccountId()).contains(filter, Qt::CaseInsensitive);
-
-        bool dateMatches = t.getTransactionDate().toString("yyyy-MM-dd").contains(filter);
-
-        return nameMatches || descriptionMatches || categoryMatches ||
-            financialAccountMatches || typeMatches || dateMatches;
-        });
+    reloadTransactionList();
 }
-/** @brief Method that sets up selected column id on which sorting will occur and calls refresh view method where an actual sorting method is called. */
+/** @brief Method that sets up selected column id on which sorting will occur and restarts the listing in that order. */
 void TransactionController::handleSortingRequest(int columnId)
 {
     setSelectedColumnId(columnId);
-    refreshTransactionsView();
-}
-/** @brief An actual method for handling sorting transactions. */
-void TransactionController::executeSortingTransaction(QVector<Transaction>& allTransactions) 
-{
-    executeSorting(allTransactions, [this](const Transaction& a, const Transaction& b) {
-        switch (getSelectedColumnId()) {
-        case 1:
-            return a.getTransactionName().toLower() < b.getTransactionName().toLower();
-        case 2:
-            return a.getTransactionDate() < b.getTransactionDate();
-        case 4: 
-            return a.getTransactionAmount() < b.getTransactionAmount();
-        case 6: 
-            return categoryRepository.getCategoryNameById(a.getCategoryId()).toLower() <
-                categoryRepository.getCategoryNameById(b.getCategoryId()).toLower();
-        case 7: 
-            return financialAccountRepository.getFinancialAccountNameById(a.getFinancialAccountId()).toLower() <
-                financialAccountRepository.getFinancialAccountNameById(b.getFinancialAccountId()).toLower();
-        default: 
-            return a.getTransactionId() < b.getTransactionId();
-        }
-        });
+    reloadTransactionList();
 }
@@ -5,16 +5,12 @@
 #pragma once
 #include "Controller/BaseController.h"
 
-#include <Model/Repositories/TransactionRepository.h>
-#include <Model/Repositories/CategoryRepository.h>
-#include <Model/Repositories/FinancialAccountRepository.h>
-#include <Model/Repositories/ProfileRepository.h>
+#include <Model/Repositories/AsyncRepository.h>
 #include <Model/TransactionBuilder.h>
 
 #include "View/TransactionWindowView.h"
 #include "View/TransactionEditorDialogView.h"
 #include <QPointer>
-#include <memory>
 
  /**
   * @class TransactionController
@@ -25,14 +21,10 @@ class TransactionController : public BaseController
     Q_OBJECT
 public:
     /**
-     * @brief Constructs the TransactionController with necessary repositories.
-     * @param transactionRepositoryRef Reference to transaction repository.
-     * @param categoryRepositoryRef Reference to category repository.
-     * @param financialAccountRepositoryRef Reference to financial account repository.
-     * @param profileRepositoryRef Reference to profile repository.
+     * @brief Constructs the TransactionController. Every query runs on the database pool through AsyncRepository.
      * @param parent Parent QObject.
      */
-    TransactionController(TransactionRepository& transactionRepositoryRef, CategoryRepository& categoryRepositoryRef, FinancialAccountRepository& financialAccountRepositoryRef, ProfilesRepository& profileRepositoryRef, QObject* parent = nullptr);
+    explicit TransactionController(QObject* parent = nullptr);
 
     /** @brief Starts the controller. */
     void run() override;
@@ -45,7 +37,7 @@ public slots:
     void handleAddTransactionRequest();
 
     /**
-     * @brief Filters transactions based on search text.
+     * @brief Filters transactions based on search text. The filter is applied by SQLite and the listing restarts.
      * @param searchText The text to search for (name, type, category, etc.).
      */
     void handleFilteringTransactionRequest(QString searchText);
@@ -53,27 +45,72 @@ public slots:
     /** @brief Opens dialog to update monthly budget limit. */
     void handleEditBudgetRequest();
 
-private:
-	TransactionRepository& transactionRepository;
-    CategoryRepository& categoryRepository;
-    FinancialAccountRepository& financialAccountRepository;
-    ProfilesRepository& profileRepository;
+protected:
+    void showLoading(bool loading) override;
 
+private:
     QPointer<TransactionWindow> transactionView;
 
+    static constexpr int pageSize = 256;                ///< Rows fetched per page.
+
+    TransactionRepository::PageCursor nextPageCursor;   ///< Where the page after the last one shown starts.
+    quint64 listingGeneration = 0;                      ///< Incremented when the listing restarts; pages of older listings are dropped.
+    quint64 budgetGeneration = 0;                       ///< Incremented per budget refresh; stale results are dropped.
+
+    /**
+     * @struct EditorChoices
+     * @brief Categories and accounts offered by the transaction editor, loaded in one round trip.
+     */
+    struct EditorChoices
+    {
+        QVector<Category> categories;
+        QVector<FinancialAccount> accounts;
+    };
+
+    /**
+     * @struct BudgetStatus
+     * @brief Figures shown by the budget bar.
+     */
+    struct BudgetStatus
+    {
+        Money limit;
+        Money monthlySpent;
+    };
+
+    /** @brief Runs on the database pool. */
+    static EditorChoices loadEditorChoices(int profileId);
+
+    /** @brief Opens the editor for a new transaction once its choices have loaded. */
+    void openAddDialog(const EditorChoices& choices);
+
+    /** @brief Opens the editor for an existing transaction once it and its choices have loaded. */
+    void openEditDialog(const Transaction& currentTrans, const EditorChoices& choices);
+
+    /** @brief Handles the editor's inline "add category" and "add account" requests asynchronously. */
+    void connectEditorRequests(TransactionEditorDialogView& dialog);
+
     void handleDeleteTransactionRequest();
 
     void refreshTransactionsView();
 
+    /** @brief Restarts the listing at the first page for the current profile, sort column and filter. */
+    void reloadTransactionList();
+
+    /** @brief Fetches the page following the last one shown and appends it. */
+    void loadNextPage();
+
+    /** @brief Builds a page request from the current profile, sort column, direction and filter. */
+    TransactionRepository::PageRequest currentPageRequest();
+
+    /** @brief Maps a grid column to the repository ordering (unsortable columns order by ID). */
+    static TransactionRepository::SortColumn sortColumnFor(int columnId);
+
+    void refreshBudgetDisplay();
+
     void handleEditTransactionRequest();
     /**
      * @brief Handles column sort request.
      * @param columnId The column index to sort by.
      */
     void handleSortingRequest(int columnId);
-    void executeSortingTransaction(QVector<Transaction>& allTransactions);
-
-    void executeSortingTransaction(QVector<Transaction>& allTransactions) const;
-
-    QVector<Transaction> executeFilteringTransaction(const QVector<Transaction> allTransactions);
 };
\ No newline at end of file
@@ -0,0 +1,318 @@
+/**
+ * @file QueryLog.cpp
+ * @brief Implementation of the slow-query log.
+ */
+#include "Diagnostics/QueryLog.h"
+#include <QDateTime>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QSettings>
+#include <QSqlError>
+#include <QSqlRecord>
+#include <QThread>
+#include <algorithm>
+
+QueryLog::QueryLog() : settingsValue(loadSettings())
+{
+}
+
+QueryLog& QueryLog::instance()
+{
+    static QueryLog instance;
+    return instance;
+}
+/** @brief Same file as the database performance profile; the environment wins over the file for the threshold. */
+QueryLog::Settings QueryLog::loadSettings()
+{
+    QSettings iniSettings("BudgetDatabase.ini", QSettings::IniFormat);
+    iniSettings.beginGroup("slow_query_log");
+
+    Settings loaded;
+    loaded.thresholdMs = iniSettings.value("threshold_ms", loaded.thresholdMs).toDouble();
+    loaded.explain = iniSettings.value("explain", loaded.explain).toBool();
+    loaded.countRows = iniSettings.value("count_rows", loaded.countRows).toBool();
+    loaded.filePath = iniSettings.value("file", loaded.filePath).toString();
+    loaded.maxFileBytes = iniSettings.value("max_file_size", loaded.maxFileBytes).toLongLong();
+    loaded.maxFiles = iniSettings.value("max_files", loaded.maxFiles).toInt();
+    iniSettings.endGroup();
+
+    bool validThreshold = false;
+    const double environmentThreshold = qEnvironmentVariable("BMA_SLOW_QUERY_MS").toDouble(&validThreshold);
+    if (validThreshold) {
+        loaded.thresholdMs = environmentThreshold;
+    }
+    return loaded;
+}
+
+void QueryLog::configure(const Settings& newSettings)
+{
+    QMutexLocker locker(&statsMutex);
+    settingsValue = newSettings;
+}
+
+QueryLog::Settings QueryLog::settings() const
+{
+    QMutexLocker locker(&statsMutex);
+    return settingsValue;
+}
+
+bool QueryLog::exec(QSqlQuery& query, const QSqlDatabase& connection)
+{
+    QElapsedTimer timer;
+    timer.start();
+    const bool ok = query.exec();
+    record(query, query.lastQuery(), timer.nsecsElapsed(), ok, connection);
+    return ok;
+}
+
+bool QueryLog::exec(QSqlQuery& query, const QString& sql, const QSqlDatabase& connection)
+{
+    QElapsedTimer timer;
+    timer.start();
+    const bool ok = query.exec(sql);
+    record(query, sql, timer.nsecsElapsed(), ok, connection);
+    return ok;
+}
+/** @brief The totals are updated under the lock; the slow entry is built and written outside it. */
+void QueryLog::record(QSqlQuery& query, const QString& sql, qint64 elapsedNanoseconds, bool ok, const QSqlDatabase& connection)
+{
+    bool slow = false;
+    {
+        QMutexLocker locker(&statsMutex);
+        if (settingsValue.thresholdMs < 0) return;
+        slow = elapsedNanoseconds >= static_cast<qint64>(settingsValue.thresholdMs * 1000000.0);
+
+        StatementStats& entry = stats[sql];
+        if (entry.sql.isEmpty()) {
+            entry.sql = sql;
+        }
+        ++entry.calls;
+        entry.totalNanoseconds += elapsedNanoseconds;
+        entry.maxNanoseconds = std::max(entry.maxNanoseconds, elapsedNanoseconds);
+        if (slow) ++entry.slowCalls;
+        if (!ok) ++entry.failures;
+    }
+    if (!slow) return;
+
+    qDebug() << "Slow statement:" << elapsedNanoseconds / 1000000.0 << "ms" << sql.simplified().left(120);
+    append(describeSlowStatement(query, sql, elapsedNanoseconds, ok, connection));
+}
+/**
+ * @brief Rows of a SELECT can only be counted with a second query because exec() has only stepped to the first one.
+ * That re-run costs as much as the slow statement itself, so it happens only when count_rows is enabled.
+ */
+QString QueryLog::describeSlowStatement(QSqlQuery& query, const QString& sql, qint64 elapsedNanoseconds, bool ok, const QSqlDatabase& connection) const
+{
+    const Settings current = settings();
+    QStringList lines;
+    lines << QString("%1 slow statement: %2 ms on %3")
+        .arg(QDateTime::currentDateTime().toString(Qt::ISODateWithMs))
+        .arg(elapsedNanoseconds / 1000000.0, 0, 'f', 3)
+        .arg(QThread::currentThread()->objectName().isEmpty() ? QStringLiteral("unnamed thread") : QThread::currentThread()->objectName());
+    lines << "  SQL: " + sql.simplified();
+
+    const QStringList parameters = describeParameters(query);
+    if (!parameters.isEmpty()) {
+        lines << "  Parameters: " + parameters.join(", ");
+    }
+
+    if (!ok) {
+        lines << "  Failed: " + query.lastError().text();
+    }
+    else if (query.isSelect()) {
+        const qint64 rows = current.countRows ? countSelectRows(sql, query, connection) : -1;
+        lines << "  Rows returned: " + (rows >= 0 ? QString::number(rows) : QStringLiteral("not counted"));
+    }
+    else {
+        lines << "  Rows changed: " + QString::number(query.numRowsAffected());
+    }
+
+    if (current.explain) {
+        lines << "  Query plan:";
+        for (const QString& step : explainQueryPlan(sql, query, connection)) {
+            lines << "    " + step;
+        }
+    }
+    return lines.join('\n') + '\n';
+}
+/** @brief Values are described by type and size only, so the log never contains user data. */
+QStringList QueryLog::describeParameters(const QSqlQuery& query)
+{
+    const QStringList names = query.boundValueNames();
+    const QVariantList values = query.boundValues();
+
+    QStringList parameters;
+    for (qsizetype i = 0; i < values.size(); ++i) {
+        const QVariant& value = values.at(i);
+        QString shape;
+        if (value.isNull()) {
+            shape = "null";
+        }
+        else {
+            switch (value.typeId()) {
+            case QMetaType::Int:
+            case QMetaType::UInt:
+            case QMetaType::LongLong:
+            case QMetaType::ULongLong:
+            case QMetaType::Bool:
+                shape = "int";
+                break;
+            case QMetaType::Double:
+                shape = "real";
+                break;
+            case QMetaType::QString:
+                shape = QString("text(%1)").arg(value.toString().size());
+                break;
+            case QMetaType::QByteArray:
+                shape = QString("blob(%1)").arg(value.toByteArray().size());
+                break;
+            default:
+                shape = QString::fromLatin1(value.typeName());
+                break;
+            }
+        }
+        const QString name = i < names.size() ? names.at(i) : QString("?%1").arg(i + 1);
+        parameters << name + "=" + shape;
+    }
+    return parameters;
+}
+
+bool QueryLog::prepareWithSameValues(QSqlQuery& wrapper, const QString& wrappedSql, const QSqlQuery& original)
+{
+    if (!wrapper.prepare(wrappedSql)) return false;
+
+    const QStringList names = original.boundValueNames();
+    const QVariantList values = original.boundValues();
+    for (qsizetype i = 0; i < values.size(); ++i) {
+        if (i < names.size() && names.at(i).startsWith(':')) {
+            wrapper.bindValue(names.at(i), values.at(i));
+        }
+        else {
+            wrapper.bindValue(static_cast<int>(i), values.at(i));
+        }
+    }
+    return true;
+}
+/** @brief SQLite reports each plan step with its parent's id; steps are indented under their parent. */
+QStringList QueryLog::explainQueryPlan(const QString& sql, const QSqlQuery& original, const QSqlDatabase& connection)
+{
+    QSqlQuery plan(connection);
+    plan.setForwardOnly(true);
+    if (!prepareWithSameValues(plan, "EXPLAIN QUERY PLAN " + sql, original) || !plan.exec()) {
+        return { "unavailable: " + plan.lastError().text() };
+    }
+
+    QHash<int, int> depthById;
+    QStringList steps;
+    while (plan.next()) {
+        const int id = plan.value(0).toInt();
+        const int parent = plan.value(1).toInt();
+        const QString detail = plan.value(3).toString();
+
+        const int depth = depthById.value(parent, -1) + 1;
+        depthById.insert(id, depth);
+
+        const bool fullScan = detail.startsWith("SCAN") && !detail.contains("USING");
+        steps << QString(depth * 2, ' ') + detail + (fullScan ? QStringLiteral("   <-- full scan") : QString());
+    }
+    return steps;
+}
+
+qint64 QueryLog::countSelectRows(const QString& sql, const QSqlQuery& original, const QSqlDatabase& connection)
+{
+    QSqlQuery count(connection);
+    count.setForwardOnly(true);
+    if (!prepareWithSameValues(count, "SELECT COUNT(*) FROM (" + sql + ")", original) || !count.exec() || !count.next()) {
+        return -1;
+    }
+    return count.value(0).toLongLong();
+}
+/** @brief Rotation shifts SlowQueries.log.N to .N+1, dropping the oldest, then starts an empty file. */
+void QueryLog::append(const QString& text)
+{
+    const Settings current = settings();
+    if (current.filePath.isEmpty()) return;
+
+    QMutexLocker locker(&fileMutex);
+    const QByteArray bytes = text.toUtf8();
+    const QFileInfo info(current.filePath);
+    if (info.exists() && info.size() + bytes.size() > current.maxFileBytes) {
+        QFile::remove(QString("%1.%2").arg(current.filePath).arg(current.maxFiles));
+        for (int index = current.maxFiles - 1; index >= 1; --index) {
+            QFile::rename(QString("%1.%2").arg(current.filePath).arg(index), QString("%1.%2").arg(current.filePath).arg(index + 1));
+        }
+        if (current.maxFiles > 0) {
+            QFile::rename(current.filePath, current.filePath + ".1");
+        }
+        else {
+            QFile::remove(current.filePath);
+        }
+    }
+
+    QFile file(current.filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qDebug() << "QueryLog: could not open" << current.filePath << file.errorString();
+        return;
+    }
+    file.write(bytes);
+}
+
+QVector<QueryLog::StatementStats> QueryLog::topStatements(int count) const
+{
+    QVector<StatementStats> sorted;
+    {
+        QMutexLocker locker(&statsMutex);
+        sorted = QVector<StatementStats>(stats.cbegin(), stats.cend());
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const StatementStats& left, const StatementStats& right) {
+        return left.totalNanoseconds > right.totalNanoseconds;
+    });
+    if (sorted.size() > count) {
+        sorted.resize(count);
+    }
+    return sorted;
+}
+/** @brief The summary goes to the log file only when the session logged a slow statement, so quiet runs leave no file. */
+void QueryLog::writeSummary(int count)
+{
+    quint64 executions = 0;
+    quint64 slowExecutions = 0;
+    qsizetype distinctStatements = 0;
+    {
+        QMutexLocker locker(&statsMutex);
+        for (const StatementStats& entry : std::as_const(stats)) {
+            executions += entry.calls;
+            slowExecutions += entry.slowCalls;
+        }
+        distinctStatements = stats.size();
+    }
+    if (executions == 0) return;
+
+    QStringList lines;
+    lines << QString("%1 summary: %2 executions of %3 statements, %4 slow; top %5 by total time:")
+        .arg(QDateTime::currentDateTime().toString(Qt::ISODateWithMs))
+        .arg(executions).arg(distinctStatements).arg(slowExecutions).arg(count);
+
+    int rank = 1;
+    for (const StatementStats& entry : topStatements(count)) {
+        lines << QString("  %1. total %2 ms, %3 calls, mean %4 ms, max %5 ms, %6 slow, %7 failed: %8")
+            .arg(rank++)
+            .arg(entry.totalNanoseconds / 1000000.0, 0, 'f', 3)
+            .arg(entry.calls)
+            .arg(entry.totalNanoseconds / 1000000.0 / entry.calls, 0, 'f', 3)
+            .arg(entry.maxNanoseconds / 1000000.0, 0, 'f', 3)
+            .arg(entry.slowCalls)
+            .arg(entry.failures)
+            .arg(entry.sql.simplified());
+    }
+
+    for (const QString& line : lines) {
+        qDebug().noquote() << line;
+    }
+    if (slowExecutions > 0) {
+        append(lines.join('\n') + '\n');
+    }
+}
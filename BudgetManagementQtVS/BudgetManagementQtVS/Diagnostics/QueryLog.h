@@ -0,0 +1,127 @@
+/**
+ * @file QueryLog.h
+ * @brief Header file for the slow-query log.
+ */
+#pragma once
+#include <QHash>
+#include <QMutex>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+ /**
+  * @class QueryLog
+  * @brief Times every statement executed through BaseRepository::exec and keeps per-statement totals.
+  *
+  * A statement slower than the threshold is written to a rotating log file with the shapes of its bound
+  * values (type and length, never the values themselves), the rows it changed and, if enabled, the rows
+  * it returned and its EXPLAIN QUERY PLAN. writeSummary() reports the statements that took the most total time.
+  *
+  * Settings come from the [slow_query_log] group of BudgetDatabase.ini; the BMA_SLOW_QUERY_MS environment
+  * variable overrides the threshold.
+  */
+class QueryLog
+{
+public:
+    /**
+     * @struct Settings
+     * @brief Slow-query log configuration.
+     */
+    struct Settings
+    {
+        double thresholdMs = 50.0;                  ///< Statements at least this slow are logged; negative disables timing.
+        bool explain = false;                       ///< Capture EXPLAIN QUERY PLAN for slow statements.
+        bool countRows = false;                     ///< Count the rows of slow SELECTs; re-runs each one as COUNT(*), doubling its cost.
+        QString filePath = "SlowQueries.log";
+        qint64 maxFileBytes = 1024 * 1024;          ///< The log rotates when it would grow past this size.
+        int maxFiles = 3;                           ///< Rotated files kept: SlowQueries.log.1 ... .maxFiles.
+    };
+
+    /**
+     * @struct StatementStats
+     * @brief Totals for one SQL text.
+     */
+    struct StatementStats
+    {
+        QString sql;
+        quint64 calls = 0;
+        quint64 slowCalls = 0;
+        quint64 failures = 0;
+        qint64 totalNanoseconds = 0;
+        qint64 maxNanoseconds = 0;
+    };
+
+    /**
+     * @brief Accesses the single instance of the QueryLog.
+     * @return Reference to the singleton instance.
+     */
+    static QueryLog& instance();
+
+    /** @brief Reads the settings from BudgetDatabase.ini and the environment. */
+    static Settings loadSettings();
+
+    /** @brief Replaces the settings; affects statements executed afterwards. */
+    void configure(const Settings& newSettings);
+
+    /** @brief Returns the current settings. */
+    Settings settings() const;
+
+    /**
+     * @brief Executes a prepared statement and records its timing.
+     * Only exec() is timed: SQLite computes the first row there, so sorts and aggregates are included,
+     * but stepping through further rows is not.
+     * @param query The prepared statement.
+     * @param connection The connection the statement runs on; used to explain slow statements.
+     * @return The result of query.exec().
+     */
+    bool exec(QSqlQuery& query, const QSqlDatabase& connection);
+
+    /**
+     * @brief Executes SQL text directly and records its timing.
+     * @return The result of query.exec(sql).
+     */
+    bool exec(QSqlQuery& query, const QString& sql, const QSqlDatabase& connection);
+
+    /**
+     * @brief Returns the statements with the highest total time, slowest first.
+     * @param count Maximum number of statements returned.
+     */
+    QVector<StatementStats> topStatements(int count) const;
+
+    /**
+     * @brief Writes the top statements by total time to the debug output and the log file.
+     * @param count Number of statements reported.
+     */
+    void writeSummary(int count = 10);
+
+private:
+    QueryLog();
+
+    /** @brief Adds one execution to the totals and logs it if it was slow. */
+    void record(QSqlQuery& query, const QString& sql, qint64 elapsedNanoseconds, bool ok, const QSqlDatabase& connection);
+
+    /** @brief Builds the log entry of a slow statement. */
+    QString describeSlowStatement(QSqlQuery& query, const QString& sql, qint64 elapsedNanoseconds, bool ok, const QSqlDatabase& connection) const;
+
+    /** @brief Returns "name=type" for every bound value, e.g. ":profile_id=int", ":filter=text(12)". */
+    static QStringList describeParameters(const QSqlQuery& query);
+
+    /** @brief Prepares a statement wrapping the SQL text and binds the original query's values to it. */
+    static bool prepareWithSameValues(QSqlQuery& wrapper, const QString& wrappedSql, const QSqlQuery& original);
+
+    /** @brief Returns the EXPLAIN QUERY PLAN rows, indented by depth, or an error line. */
+    static QStringList explainQueryPlan(const QString& sql, const QSqlQuery& original, const QSqlDatabase& connection);
+
+    /** @brief Returns the number of rows a SELECT returns, or -1 if it could not be counted. */
+    static qint64 countSelectRows(const QString& sql, const QSqlQuery& original, const QSqlDatabase& connection);
+
+    /** @brief Appends text to the log file, rotating it first if it would grow past the size limit. */
+    void append(const QString& text);
+
+    mutable QMutex statsMutex;                  ///< Guards settingsValue and stats.
+    QMutex fileMutex;                           ///< Serializes writes and rotation of the log file.
+    Settings settingsValue;
+    QHash<QString, StatementStats> stats;       ///< SQL text -> totals.
+};
@@ -0,0 +1,167 @@
+/**
+ * @file Tracer.cpp
+ * @brief Implementation of the scoped-timer tracing facility.
+ */
+#include "Diagnostics/Tracer.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+#include <QDebug>
+
+Tracer::Scope::Scope(const char* category, const char* name) : category(category), name(name), start(Tracer::instance().now())
+{
+}
+
+Tracer::Scope::~Scope()
+{
+    Tracer& tracer = Tracer::instance();
+    tracer.record(category, name, start, tracer.now() - start);
+}
+
+Tracer::Tracer() : path(qEnvironmentVariable("BMA_TRACE_FILE"))
+{
+    clock.start();
+}
+
+Tracer& Tracer::instance()
+{
+    static Tracer instance;
+    return instance;
+}
+
+void Tracer::setOutputPath(const QString& outputPath)
+{
+    QMutexLocker locker(&registryMutex);
+    path = outputPath;
+}
+
+QString Tracer::outputPath() const
+{
+    QMutexLocker locker(&registryMutex);
+    return path;
+}
+
+qint64 Tracer::now() const
+{
+    return clock.nsecsElapsed();
+}
+/**
+ * @brief Writes the slot first, then publishes it; a reader never sees a slot before its head covers it.
+ * The release fence pairs with the reader's acquire fence: a reader that loads any field of this write also
+ * sees head == index afterwards, so it knows the slot's previous event is being overwritten.
+ */
+void Tracer::record(const char* category, const char* name, qint64 start, qint64 duration)
+{
+    ThreadRing& ring = localRing();
+    const quint64 index = ring.head.load(std::memory_order_relaxed);
+    EventSlot& slot = ring.events[index % ringCapacity];
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.duration.store(duration, std::memory_order_relaxed);
+    ring.head.store(index + 1, std::memory_order_release);
+}
+/** @brief The registry lock is taken once per thread; afterwards the ring is reached through a thread_local pointer. */
+Tracer::ThreadRing& Tracer::localRing()
+{
+    thread_local ThreadRing* threadRing = nullptr;
+    if (threadRing) {
+        return *threadRing;
+    }
+
+    auto ring = std::make_unique<ThreadRing>();
+    ring->events = std::make_unique<EventSlot[]>(ringCapacity);
+    QThread* thread = QThread::currentThread();
+    const QCoreApplication* application = QCoreApplication::instance();
+    ring->threadName = application && thread == application->thread() ? QStringLiteral("Main thread") : thread->objectName();
+
+    QMutexLocker locker(&registryMutex);
+    ring->threadId = static_cast<int>(rings.size()) + 1;
+    if (ring->threadName.isEmpty()) {
+        ring->threadName = QString("Thread %1").arg(ring->threadId);
+    }
+    threadRing = ring.get();
+    rings.push_back(std::move(ring));
+    return *threadRing;
+}
+/**
+ * @brief Emits one complete ("X") event per scope plus thread name metadata, with times in microseconds.
+ * Slots are copied between two reads of the ring's head; those the owning thread may have overwritten in between are dropped.
+ * The acquire fence keeps the slot loads before the second head read, so a slot outside the dropped range was not
+ * written during its copy.
+ */
+bool Tracer::writeChromeTrace(const QString& requestedPath)
+{
+    QString outputFile = requestedPath.isEmpty() ? outputPath() : requestedPath;
+    if (outputFile.isEmpty()) {
+        outputFile = QStringLiteral("BudgetTrace.json");
+    }
+
+    QJsonArray traceEvents;
+    int droppedEvents = 0;
+    {
+        QMutexLocker locker(&registryMutex);
+        for (const std::unique_ptr<ThreadRing>& ring : rings) {
+            QJsonObject threadName;
+            threadName["name"] = "thread_name";
+            threadName["ph"] = "M";
+            threadName["pid"] = 1;
+            threadName["tid"] = ring->threadId;
+            threadName["args"] = QJsonObject{ { "name", ring->threadName } };
+            traceEvents.append(threadName);
+
+            const quint64 head = ring->head.load(std::memory_order_acquire);
+            const quint64 first = head > ringCapacity ? head - ringCapacity : 0;
+            std::vector<Event> copied;
+            copied.reserve(head - first);
+            for (quint64 index = first; index < head; ++index) {
+                const EventSlot& slot = ring->events[index % ringCapacity];
+                Event event;
+                event.category = slot.category.load(std::memory_order_relaxed);
+                event.name = slot.name.load(std::memory_order_relaxed);
+                event.start = slot.start.load(std::memory_order_relaxed);
+                event.duration = slot.duration.load(std::memory_order_relaxed);
+                copied.push_back(event);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const quint64 headAfterCopy = ring->head.load(std::memory_order_relaxed);
+            // The slot of index headAfterCopy may be mid-write, and it holds index headAfterCopy - ringCapacity.
+            const quint64 firstIntact = headAfterCopy + 1 > ringCapacity ? headAfterCopy + 1 - ringCapacity : 0;
+            for (quint64 index = first; index < head; ++index) {
+                if (index < firstIntact) {
+                    ++droppedEvents;
+                    continue;
+                }
+                const Event& event = copied[index - first];
+                QJsonObject traceEvent;
+                traceEvent["name"] = QString::fromLatin1(event.name);
+                traceEvent["cat"] = QString::fromLatin1(event.category);
+                traceEvent["ph"] = "X";
+                traceEvent["ts"] = event.start / 1000.0;
+                traceEvent["dur"] = event.duration / 1000.0;
+                traceEvent["pid"] = 1;
+                traceEvent["tid"] = ring->threadId;
+                traceEvents.append(traceEvent);
+            }
+        }
+    }
+
+    QJsonObject trace;
+    trace["traceEvents"] = traceEvents;
+    trace["displayTimeUnit"] = "ms";
+
+    QFile file(outputFile);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << "Tracer: could not open" << outputFile << file.errorString();
+        return false;
+    }
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+    qDebug() << "Tracer: wrote" << traceEvents.size() << "events to" << outputFile << "(dropped" << droppedEvents << "overwritten during the copy)";
+    return true;
+}
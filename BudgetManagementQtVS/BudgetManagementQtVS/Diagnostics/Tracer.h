@@ -0,0 +1,144 @@
+/**
+ * @file Tracer.h
+ * @brief Header file for the scoped-timer tracing facility.
+ *
+ * Tracing is compiled in for debug builds and for any build defining BMA_ENABLE_TRACING; defining
+ * BMA_DISABLE_TRACING turns it off everywhere. When it is compiled out, BMA_TRACE_SCOPE expands to nothing.
+ */
+#pragma once
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QString>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#if !defined(BMA_DISABLE_TRACING) && (defined(BMA_ENABLE_TRACING) || !defined(QT_NO_DEBUG))
+#define BMA_TRACING_ENABLED 1
+#else
+#define BMA_TRACING_ENABLED 0
+#endif
+
+#define BMA_TRACE_CONCAT_INNER(a, b) a##b
+#define BMA_TRACE_CONCAT(a, b) BMA_TRACE_CONCAT_INNER(a, b)
+
+#if BMA_TRACING_ENABLED
+/**
+ * @brief Records the enclosing scope as one trace event.
+ * @param category Event category shown by the trace viewer ("repository", "controller", "view", "chart", ...).
+ * @param name Event name. Both arguments must be string literals: only the pointers are stored.
+ */
+#define BMA_TRACE_SCOPE(category, name) const Tracer::Scope BMA_TRACE_CONCAT(bmaTraceScope, __LINE__)(category, name)
+#else
+#define BMA_TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
+
+ /**
+  * @class Tracer
+  * @brief Collects scoped timing events and writes them as Chrome trace-event JSON
+  * (open in chrome://tracing or https://ui.perfetto.dev).
+  *
+  * Every thread records into its own fixed-size ring buffer, so recording takes no lock: the owning thread
+  * writes the slot's fields with relaxed atomic stores and then publishes it with a release store of the ring's
+  * head. When a ring is full, the oldest events are overwritten. Writing the trace reads every ring while threads
+  * keep recording, as a seqlock reader does: it re-reads the head after the copy and drops the slots that may
+  * have been overwritten in between.
+  */
+class Tracer
+{
+public:
+    /**
+     * @class Scope
+     * @brief Records the time between its construction and destruction on the calling thread.
+     */
+    class Scope
+    {
+    public:
+        Scope(const char* category, const char* name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* category;
+        const char* name;
+        qint64 start;
+    };
+
+    /**
+     * @brief Accesses the single instance of the Tracer.
+     * @return Reference to the singleton instance.
+     */
+    static Tracer& instance();
+
+    /**
+     * @brief Sets the file written by writeChromeTrace() when no path is given.
+     * The BMA_TRACE_FILE environment variable sets the initial value.
+     */
+    void setOutputPath(const QString& path);
+
+    /** @brief Returns the configured trace file, or an empty string if none is set. */
+    QString outputPath() const;
+
+    /**
+     * @brief Writes every buffered event as Chrome trace-event JSON.
+     * @param path Destination file; if empty, the configured output path, or BudgetTrace.json if none is set.
+     * @return True if the file was written.
+     */
+    bool writeChromeTrace(const QString& path = QString());
+
+    /** @brief Returns the nanoseconds elapsed since the tracer was created. */
+    qint64 now() const;
+
+    /** @brief Appends one completed event to the calling thread's ring. */
+    void record(const char* category, const char* name, qint64 start, qint64 duration);
+
+private:
+    /**
+     * @struct Event
+     * @brief One completed scope, as copied out of a ring.
+     */
+    struct Event
+    {
+        const char* category = nullptr;
+        const char* name = nullptr;
+        qint64 start = 0;           ///< Nanoseconds since the tracer was created.
+        qint64 duration = 0;        ///< Nanoseconds.
+    };
+
+    /**
+     * @struct EventSlot
+     * @brief One ring slot. The fields are atomics because the writer may overwrite a slot while a reader copies it.
+     */
+    struct EventSlot
+    {
+        std::atomic<const char*> category{ nullptr };
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<qint64> start{ 0 };
+        std::atomic<qint64> duration{ 0 };
+    };
+
+    /**
+     * @struct ThreadRing
+     * @brief Events of one thread. Written only by that thread; kept after it exits so its events can still be written.
+     */
+    struct ThreadRing
+    {
+        int threadId = 0;                   ///< Sequential ID used as "tid" in the trace.
+        QString threadName;
+        std::unique_ptr<EventSlot[]> events;    ///< ringCapacity slots.
+        std::atomic<quint64> head{ 0 };     ///< Number of events ever recorded; the next slot is head % ringCapacity.
+    };
+
+    static constexpr quint64 ringCapacity = 1 << 16;    ///< Events kept per thread (2 MiB per thread).
+
+    Tracer();
+
+    /** @brief Returns the calling thread's ring, registering it on first use. */
+    ThreadRing& localRing();
+
+    QElapsedTimer clock;
+    mutable QMutex registryMutex;                       ///< Guards rings and path; never taken while recording.
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+    QString path;
+};
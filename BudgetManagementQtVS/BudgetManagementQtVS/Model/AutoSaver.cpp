@@ -0,0 +1,148 @@
+/**
+ * @file AutoSaver.cpp
+ * @brief Implementation of the incremental background autosave.
+ */
+#include "Model/AutoSaver.h"
+#include "Model/CsvExporter.h"
+#include "Model/Repositories/ChangeLogRepository.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QDebug>
+
+/** @brief Constructor. Repositories are created inside saveChanges, so they bind to the worker thread's connection. */
+AutoSaver::AutoSaver(QObject* parent)
+    : QObject(parent), cancelled(false)
+{
+}
+
+QString AutoSaver::snapshotPath(int userId)
+{
+    return QString("autosave_user_%1.csv").arg(userId);
+}
+
+QString AutoSaver::deltaPath(int userId)
+{
+    return QString("autosave_user_%1.delta.csv").arg(userId);
+}
+
+void AutoSaver::requestCancel()
+{
+    cancelled.storeRelaxed(true);
+}
+
+/**
+ * @brief Reads the high-water mark first, so changes made while saving are left for the next call.
+ * A missing snapshot or delta (first run, or an interrupted compaction) triggers a full compaction instead.
+ */
+void AutoSaver::saveChanges(int userId)
+{
+    if (cancelled.loadRelaxed() || userId < 0) return;
+
+    ChangeLogRepository changeLog;
+    const qint64 upToSequence = changeLog.latestSequence(userId);
+    if (upToSequence < 0) return;
+
+    if (!QFile::exists(snapshotPath(userId)) || !QFile::exists(deltaPath(userId))) {
+        compact(userId, upToSequence);
+        return;
+    }
+    if (upToSequence == 0) return;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const int lines = appendChanges(userId, upToSequence);
+    if (lines < 0) return;
+
+    qDebug() << "Auto-save appended" << lines << "changes for user" << userId << "in" << timer.elapsed() << "ms";
+
+    const qint64 deltaSize = QFileInfo(deltaPath(userId)).size();
+    const qint64 snapshotSize = QFileInfo(snapshotPath(userId)).size();
+    if (deltaSize > qMax(minimumCompactionBytes, snapshotSize / 4)) {
+        compact(userId, changeLog.latestSequence(userId));
+    }
+}
+
+int AutoSaver::appendChanges(int userId, qint64 upToSequence)
+{
+    QFile file(deltaPath(userId));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        qDebug() << "Auto-save could not open" << file.fileName() << ":" << file.errorString();
+        return -1;
+    }
+
+    QByteArray buffer;
+    buffer.reserve(CsvExporter::flushThreshold + 4096);
+    int lines = 0;
+    bool writeFailed = false;
+
+    ChangeLogRepository changeLog;
+    const bool completed = changeLog.forEachPendingChange(userId, upToSequence, [&](const ChangeLogRepository::Change& change) {
+        switch (change.kind) {
+        case ChangeLogRepository::ChangeKind::TransactionWritten:
+            if (!change.hasRow) return true;    // Deleted or moved since; a later change covers it.
+            buffer.append("upsert,");
+            CsvExporter::appendRow(buffer, change.row);
+            break;
+        case ChangeLogRepository::ChangeKind::TransactionDeleted:
+            buffer.append("delete,,").append(QByteArray::number(change.transactionId)).append(",,,,,,,,");
+            break;
+        case ChangeLogRepository::ChangeKind::ProfileDeleted:
+            buffer.append("delete-profile,");
+            CsvExporter::appendField(buffer, change.deletedProfileName);
+            buffer.append(",,,,,,,,,");
+            break;
+        }
+        buffer.append('\n');
+        ++lines;
+
+        if (buffer.size() >= CsvExporter::flushThreshold) {
+            writeFailed = file.write(buffer) != buffer.size();
+            buffer.resize(0);
+        }
+        return !writeFailed && !cancelled.loadRelaxed();
+        });
+
+    if (completed && !writeFailed) {
+        writeFailed = file.write(buffer) != buffer.size();
+    }
+    file.close();
+
+    if (!completed || writeFailed) {
+        if (writeFailed) qDebug() << "Auto-save could not write" << file.fileName() << ":" << file.errorString();
+        return -1;
+    }
+
+    changeLog.discardChanges(userId, upToSequence);
+    return lines;
+}
+
+bool AutoSaver::compact(int userId, qint64 upToSequence)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QFile::remove(deltaPath(userId));
+
+    QString error;
+    TransactionRepository transactionRepository;
+    if (!CsvExporter::writeUserData(transactionRepository, userId, snapshotPath(userId), error, &cancelled)) {
+        qDebug() << "Auto-save compaction failed:" << error;
+        return false;
+    }
+
+    QFile delta(deltaPath(userId));
+    if (!delta.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)
+        || delta.write(QByteArray("Change,") + CsvExporter::header + '\n') < 0) {
+        qDebug() << "Auto-save could not start" << delta.fileName() << ":" << delta.errorString();
+        return false;
+    }
+    delta.close();
+
+    if (upToSequence > 0) {
+        ChangeLogRepository().discardChanges(userId, upToSequence);
+    }
+    qDebug() << "Auto-save compacted user" << userId << "in" << timer.elapsed() << "ms";
+    return true;
+}
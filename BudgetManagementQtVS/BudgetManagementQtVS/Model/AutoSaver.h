@@ -0,0 +1,62 @@
+/**
+ * @file AutoSaver.h
+ * @brief Header file for the incremental background autosave.
+ */
+#pragma once
+#include <QObject>
+#include <QAtomicInteger>
+#include <QString>
+
+ /**
+  * @class AutoSaver
+  * @brief Keeps autosave_user_N.csv current without rewriting it on every save.
+  * Lives on a worker thread and uses that thread's pooled database connection. Each save appends only the changes recorded
+  * in change_log since the last save to autosave_user_N.delta.csv, then trims the log up to the saved sequence.
+  * When the delta grows past a quarter of the snapshot, the snapshot is rewritten and the delta restarted.
+  *
+  * The delta file has a leading "Change" column (upsert, delete, delete-profile) followed by the export columns.
+  * Replaying it in order over the snapshot yields the current data; replaying a line twice is harmless.
+  */
+class AutoSaver : public QObject
+{
+    Q_OBJECT
+public:
+    explicit AutoSaver(QObject* parent = nullptr);
+
+    /** @brief Path of the full snapshot for a user. */
+    static QString snapshotPath(int userId);
+
+    /** @brief Path of the append-only delta for a user. */
+    static QString deltaPath(int userId);
+
+    /**
+     * @brief Asks a running save to stop at the next row. Thread-safe; called from the UI thread on quit.
+     * Unsaved changes stay in change_log and are picked up by the next session.
+     */
+    void requestCancel();
+
+public slots:
+    /**
+     * @brief Appends pending changes of a user, compacting when needed. Must run on the worker thread.
+     * @param userId The user whose data is saved.
+     */
+    void saveChanges(int userId);
+
+private:
+    static constexpr qint64 minimumCompactionBytes = 1024 * 1024;  ///< Deltas smaller than this are never compacted.
+
+    QAtomicInteger<bool> cancelled;     ///< Set by requestCancel().
+
+    /**
+     * @brief Appends the changes up to a sequence to the delta file.
+     * @return Number of lines written, or -1 on failure (the log is then left untouched).
+     */
+    int appendChanges(int userId, qint64 upToSequence);
+
+    /**
+     * @brief Rewrites the snapshot from the database and starts an empty delta.
+     * The delta is removed first, so an interrupted compaction is simply redone on the next save.
+     * @return True if both files were written.
+     */
+    bool compact(int userId, qint64 upToSequence);
+};
@@ -2,7 +2,7 @@
  * @file Category.cpp
  * @brief Implementation of the Category model.
  */
-#include "model/Category.h"
+#include "Model/Category.h"
 
  /** @brief Constructor initializing member variables. */
 Category::Category(int categoryId, const QString & categoryName, int profileId)
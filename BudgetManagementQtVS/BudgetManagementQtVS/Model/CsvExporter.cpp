@@ -0,0 +1,105 @@
+/**
+ * @file CsvExporter.cpp
+ * @brief Implementation of the CSV export writer.
+ */
+#include "Model/CsvExporter.h"
+#include "Model/TransactionType.h"
+#include <QSaveFile>
+#include <QElapsedTimer>
+#include <QDebug>
+
+const char* const CsvExporter::header =
+    "Profile,Transaction ID,Name,Date,Description,Amount,Type,Category,Account,Account Type";
+
+void CsvExporter::appendField(QByteArray& out, const QString& value)
+{
+    const QByteArray utf8 = value.toUtf8();
+    if (utf8.contains(',') || utf8.contains('"') || utf8.contains('\n')) {
+        out.append('"');
+        for (char c : utf8) {
+            if (c == '"') out.append('"');
+            out.append(c);
+        }
+        out.append('"');
+    }
+    else {
+        out.append(utf8);
+    }
+}
+
+void CsvExporter::appendRow(QByteArray& out, const TransactionRepository::ExportRow& row)
+{
+    appendField(out, row.profileName);
+    out.append(',').append(QByteArray::number(row.transactionId)).append(',');
+    appendField(out, row.name);
+    out.append(',').append(row.date.toString(Qt::ISODate).toLatin1()).append(',');
+    appendField(out, row.description);
+    out.append(',').append(row.amount.toString().toLatin1()).append(',');
+    out.append(TransactionTypes::toName(row.type)).append(',');
+    appendField(out, row.categoryName);
+    out.append(',');
+    appendField(out, row.accountName);
+    out.append(',');
+    appendField(out, row.accountType);
+}
+/**
+ * @brief Streams the joined cursor into a QSaveFile, so a failed or cancelled write never truncates the previous file.
+ */
+bool CsvExporter::writeUserData(const TransactionRepository& repository, int userId, const QString& filePath,
+    QString& errorMessage, const QAtomicInteger<bool>* cancelled)
+{
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        errorMessage = "Could not open file for writing.";
+        return false;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QByteArray buffer;
+    buffer.reserve(flushThreshold + 4096);
+    buffer.append(header).append('\n');
+
+    qint64 rowCount = 0;
+    qint64 bytesWritten = 0;
+    bool writeFailed = false;
+
+    auto flush = [&]() {
+        if (file.write(buffer) != buffer.size()) {
+            writeFailed = true;
+        }
+        bytesWritten += buffer.size();
+        buffer.resize(0);
+        return !writeFailed;
+    };
+
+    const bool completed = repository.forEachUserTransaction(userId, [&](const TransactionRepository::ExportRow& row) {
+        appendRow(buffer, row);
+        buffer.append('\n');
+        ++rowCount;
+
+        if (cancelled && cancelled->loadRelaxed()) return false;
+        return buffer.size() < flushThreshold || flush();
+        });
+
+    if (cancelled && cancelled->loadRelaxed()) {
+        file.cancelWriting();
+        errorMessage = "Export cancelled.";
+        return false;
+    }
+    if (writeFailed || !completed) {
+        file.cancelWriting();
+        errorMessage = writeFailed ? "Could not write to file: " + file.errorString() : "Could not read data from the database.";
+        return false;
+    }
+    if (!flush() || !file.commit()) {
+        errorMessage = "Could not write to file: " + file.errorString();
+        return false;
+    }
+
+    const double seconds = qMax<qint64>(timer.elapsed(), 1) / 1000.0;
+    qDebug() << "CSV export:" << rowCount << "rows," << bytesWritten << "bytes in" << timer.elapsed() << "ms ("
+        << qRound64(rowCount / seconds) << "rows/s," << qRound64(bytesWritten / seconds) << "bytes/s)";
+    return true;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file CsvExporter.h
+ * @brief Header file for the CSV export writer.
+ */
+#pragma once
+#include <QAtomicInteger>
+#include <QByteArray>
+#include <QString>
+
+#include "Model/Repositories/TransactionRepository.h"
+
+ /**
+  * @class CsvExporter
+  * @brief Writes transactions in the CSV layout read back by CsvImporter.
+  * Rows are encoded straight to UTF-8 into one reused buffer that is flushed in fixed-size chunks.
+  */
+class CsvExporter
+{
+public:
+    /** @brief Header line of an export file. */
+    static const char* const header;
+
+    /**
+     * @brief Appends one CSV field as UTF-8, quoting it if it contains a comma, quote or newline.
+     * @param out Buffer to append to.
+     * @param value Field text.
+     */
+    static void appendField(QByteArray& out, const QString& value);
+
+    /**
+     * @brief Appends the ten export columns of a row (without a line break).
+     * @param out Buffer to append to.
+     * @param row Row to encode.
+     */
+    static void appendRow(QByteArray& out, const TransactionRepository::ExportRow& row);
+
+    /**
+     * @brief Streams every transaction of a user into a file. The file is replaced atomically on success.
+     * @param repository Repository whose connection is read (the caller's thread must own it).
+     * @param userId The user to export.
+     * @param filePath Destination file.
+     * @param errorMessage Receives the reason on failure.
+     * @param cancelled Optional flag polled per row; when set the write is abandoned and the old file kept.
+     * @return True if the file was written.
+     */
+    static bool writeUserData(const TransactionRepository& repository, int userId, const QString& filePath,
+        QString& errorMessage, const QAtomicInteger<bool>* cancelled = nullptr);
+
+    static constexpr qsizetype flushThreshold = 256 * 1024;    ///< Buffered bytes that trigger a write.
+};
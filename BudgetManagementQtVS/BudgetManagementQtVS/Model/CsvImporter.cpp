@@ -0,0 +1,386 @@
+/**
+ * @file CsvImporter.cpp
+ * @brief Implementation of the streaming CSV importer.
+ */
+#include "Model/CsvImporter.h"
+#include "Model/CsvExporter.h"
+#include "Model/TransactionBuilder.h"
+#include "Model/TransactionType.h"
+#include <QFile>
+#include <QDebug>
+
+/** @brief Constructor. */
+CsvImporter::CsvImporter(ProfilesRepository& profileRepo, int userId)
+    : profileRepository(profileRepo), userId(userId)
+{
+}
+
+void CsvImporter::reset()
+{
+    lookups.clear();
+    lookupIndexByName.clear();
+    lastLookupIndex = -1;
+    lastProfileName.clear();
+
+    fields.resize(columnCount + 1);     // The extra slot absorbs surplus fields of malformed records.
+    for (QByteArray& field : fields) {
+        field.resize(0);
+    }
+    fieldCount = 0;
+    headerSeen = false;
+
+    batch.clear();
+    batch.reserve(batchSize);
+    batchLines.clear();
+    batchLines.reserve(batchSize);
+
+    result = Result();
+}
+/**
+ * @brief Byte-level CSV state machine over fixed-size chunks.
+ * Quoted fields may span chunks and lines; "" inside quotes is an escaped quote; CR bytes are dropped,
+ * which covers files written in text mode on Windows.
+ */
+CsvImporter::Result CsvImporter::importFile(const QString& filePath, const ProgressCallback& progress)
+{
+    reset();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        result.fatalError = QStringLiteral("Could not open file for reading.");
+        return result;
+    }
+
+    const qint64 totalBytes = file.size();
+    QByteArray chunk(chunkSize, Qt::Uninitialized);
+
+    bool inQuotes = false;
+    bool afterClosingQuote = false;
+    bool firstChunk = true;
+    qint64 line = 1;
+    qint64 recordLine = 1;
+
+    auto currentField = [this]() -> QByteArray& {
+        return fields[qMin(fieldCount, columnCount)];
+    };
+    auto endField = [this]() {
+        ++fieldCount;
+        fields[qMin(fieldCount, columnCount)].resize(0);
+    };
+    auto endRecord = [&]() {
+        endField();
+        if (!(fieldCount == 1 && fields.at(0).isEmpty())) {     // Blank lines are skipped.
+            processRecord(recordLine);
+        }
+        fieldCount = 0;
+        fields[0].resize(0);
+    };
+
+    while (true) {
+        const qint64 bytesRead = file.read(chunk.data(), chunkSize);
+        if (bytesRead < 0) {
+            result.fatalError = QStringLiteral("Read error: %1").arg(file.errorString());
+            return result;
+        }
+        if (bytesRead == 0) break;
+
+        qint64 start = 0;
+        if (firstChunk) {
+            firstChunk = false;
+            if (bytesRead >= 3 && chunk.startsWith("\xEF\xBB\xBF")) start = 3;     // UTF-8 BOM
+        }
+
+        const char* data = chunk.constData();
+        for (qint64 i = start; i < bytesRead; ++i) {
+            const char c = data[i];
+            if (c == '\r') continue;
+
+            if (inQuotes) {
+                if (c == '"') {
+                    inQuotes = false;
+                    afterClosingQuote = true;
+                }
+                else {
+                    if (c == '\n') ++line;
+                    currentField().append(c);
+                }
+                continue;
+            }
+
+            if (afterClosingQuote) {
+                afterClosingQuote = false;
+                if (c == '"') {             // Escaped quote: "" inside a quoted field.
+                    currentField().append('"');
+                    inQuotes = true;
+                    continue;
+                }
+            }
+
+            switch (c) {
+            case '"':
+                if (currentField().isEmpty()) {
+                    inQuotes = true;
+                }
+                else {
+                    currentField().append(c);
+                }
+                break;
+            case ',':
+                endField();
+                break;
+            case '\n':
+                endRecord();
+                if (!result.fatalError.isEmpty()) return result;
+                ++line;
+                recordLine = line;
+                break;
+            default:
+                currentField().append(c);
+                break;
+            }
+        }
+
+        if (progress && !progress(file.pos(), totalBytes, result.importedCount)) {
+            result.cancelled = true;
+            batch.clear();
+            batchLines.clear();
+            qDebug() << "CSV import cancelled after" << result.importedCount << "rows";
+            return result;
+        }
+    }
+
+    if (inQuotes) {
+        reject(recordLine, QStringLiteral("Unterminated quoted field."));
+    }
+    else if (fieldCount > 0 || !fields.at(0).isEmpty()) {
+        endRecord();    // Last record without a trailing newline.
+    }
+
+    if (!headerSeen && result.fatalError.isEmpty()) {
+        result.fatalError = QStringLiteral("File is empty.");
+    }
+    if (!result.fatalError.isEmpty()) return result;
+
+    flushBatch();
+    if (progress) {
+        progress(totalBytes, totalBytes, result.importedCount);
+    }
+
+    qDebug() << "CSV import finished:" << result.importedCount << "imported," << result.rejectedCount << "rejected";
+    return result;
+}
+/** @brief Validates the header, then converts the record into a Transaction and queues it. */
+void CsvImporter::processRecord(qint64 line)
+{
+    if (!headerSeen) {
+        QByteArray header;
+        for (int i = 0; i < qMin(fieldCount, columnCount); ++i) {
+            if (i > 0) header.append(',');
+            header.append(fields.at(i));
+        }
+        if (fieldCount != columnCount || header != CsvExporter::header) {
+            result.fatalError = QStringLiteral("Unrecognised header. Expected: %1").arg(QLatin1String(CsvExporter::header));
+            return;
+        }
+        headerSeen = true;
+        return;
+    }
+
+    if (fieldCount != columnCount) {
+        reject(line, QStringLiteral("Expected %1 fields, found %2.").arg(columnCount).arg(fieldCount));
+        return;
+    }
+
+    const QString profileName = QString::fromUtf8(fields.at(0));
+    const QString name = QString::fromUtf8(fields.at(2));
+    const QString categoryName = QString::fromUtf8(fields.at(7));
+    const QString accountName = QString::fromUtf8(fields.at(8));
+
+    if (profileName.isEmpty() || name.trimmed().isEmpty() || categoryName.isEmpty() || accountName.isEmpty()) {
+        reject(line, QStringLiteral("Profile, name, category and account are required."));
+        return;
+    }
+
+    const QDate date = parseDate(fields.at(3));
+    if (!date.isValid()) {
+        reject(line, QStringLiteral("Invalid date '%1'.").arg(QString::fromUtf8(fields.at(3))));
+        return;
+    }
+
+    Money amount;
+    if (!Money::tryParse(QString::fromLatin1(fields.at(5)), amount)) {
+        reject(line, QStringLiteral("Invalid amount '%1'.").arg(QString::fromUtf8(fields.at(5))));
+        return;
+    }
+
+    TransactionType type;
+    if (!TransactionTypes::tryParse(QString::fromLatin1(fields.at(6)), type)) {
+        reject(line, QStringLiteral("Invalid type '%1'.").arg(QString::fromUtf8(fields.at(6))));
+        return;
+    }
+
+    ProfileLookup* lookup = resolveProfile(profileName);
+    if (!lookup) {
+        reject(line, QStringLiteral("Could not create profile '%1'.").arg(profileName));
+        return;
+    }
+
+    const int categoryId = resolveCategory(*lookup, categoryName);
+    if (categoryId < 0) {
+        reject(line, QStringLiteral("Could not create category '%1'.").arg(categoryName));
+        return;
+    }
+
+    const int accountId = resolveAccount(*lookup, accountName, QString::fromUtf8(fields.at(9)));
+    if (accountId < 0) {
+        reject(line, QStringLiteral("Could not resolve account '%1'.").arg(accountName));
+        return;
+    }
+
+    TransactionBuilder builder;
+    builder.withProfileId(lookup->profileId)
+        .withName(name)
+        .withDate(date)
+        .withDescription(QString::fromUtf8(fields.at(4)))
+        .withAmount(amount)
+        .withType(type)
+        .withCategoryId(categoryId)
+        .withFinancialAccountId(accountId);
+
+    batch.append(builder.build());
+    batchLines.append(line);
+
+    if (batch.size() >= batchSize) {
+        flushBatch();
+    }
+}
+/** @brief Rows rejected by the repository are reported individually; a failed commit rejects the whole batch. */
+void CsvImporter::flushBatch()
+{
+    if (batch.isEmpty()) return;
+
+    const TransactionRepository::BatchInsertResult outcome = transactionRepository.addTransactions(batch);
+    if (!outcome.committed) {
+        for (qint64 line : batchLines) {
+            reject(line, QStringLiteral("Batch could not be committed."));
+        }
+    }
+    else {
+        result.importedCount += outcome.insertedCount;
+        for (qsizetype i = 0; i < outcome.ids.size(); ++i) {
+            if (outcome.ids.at(i) < 0) {
+                reject(batchLines.at(i), outcome.errors.value(i));
+            }
+        }
+    }
+
+    batch.clear();
+    batchLines.clear();
+}
+
+void CsvImporter::reject(qint64 line, const QString& message)
+{
+    ++result.rejectedCount;
+    if (result.errors.size() < maxReportedErrors) {
+        result.errors.append(QStringLiteral("Line %1: %2").arg(line).arg(message));
+    }
+}
+/** @brief Looks in the run's cache first, then among the user's profiles; failures are cached too. */
+CsvImporter::ProfileLookup* CsvImporter::resolveProfile(const QString& profileName)
+{
+    if (lastLookupIndex >= 0 && profileName == lastProfileName) {
+        ProfileLookup& lookup = lookups[lastLookupIndex];
+        return lookup.profileId >= 0 ? &lookup : nullptr;
+    }
+
+    auto it = lookupIndexByName.constFind(profileName);
+    if (it == lookupIndexByName.constEnd()) {
+        auto findProfileId = [&]() {
+            for (const Profile& profile : profileRepository.getProfilesByUserId(userId)) {
+                if (profile.getProfileName() == profileName) return profile.getProfileId();
+            }
+            return -1;
+        };
+
+        ProfileLookup lookup;
+        lookup.profileId = findProfileId();
+        if (lookup.profileId < 0 && profileRepository.addProfile(userId, profileName)) {
+            lookup.profileId = findProfileId();
+        }
+        if (lookup.profileId >= 0) {
+            loadCategories(lookup);
+            loadAccounts(lookup);
+        }
+        else {
+            qDebug() << "CSV import: could not create profile" << profileName;
+        }
+
+        lookups.append(std::move(lookup));
+        it = lookupIndexByName.insert(profileName, lookups.size() - 1);
+    }
+
+    lastLookupIndex = it.value();
+    lastProfileName = profileName;
+
+    ProfileLookup& lookup = lookups[lastLookupIndex];
+    return lookup.profileId >= 0 ? &lookup : nullptr;
+}
+
+int CsvImporter::resolveCategory(ProfileLookup& lookup, const QString& categoryName)
+{
+    auto it = lookup.categoryIds.constFind(categoryName);
+    if (it != lookup.categoryIds.constEnd()) return it.value();
+
+    if (!categoryRepository.addCategory(categoryName, lookup.profileId)) return -1;
+    loadCategories(lookup);
+    return lookup.categoryIds.value(categoryName, -1);
+}
+/** @brief Accounts the exporter could not resolve are written as "Unknown"; those are not recreated. */
+int CsvImporter::resolveAccount(ProfileLookup& lookup, const QString& accountName, const QString& accountType)
+{
+    auto it = lookup.accountIds.constFind(accountName);
+    if (it != lookup.accountIds.constEnd()) return it.value();
+
+    if (accountType.isEmpty() || accountType == QLatin1String("Unknown")) return -1;
+
+    if (!financialAccountRepository.addFinancialAccount(accountName, accountType, Money(), lookup.profileId)) return -1;
+    loadAccounts(lookup);
+    return lookup.accountIds.value(accountName, -1);
+}
+
+void CsvImporter::loadCategories(ProfileLookup& lookup) const
+{
+    lookup.categoryIds.clear();
+    for (const Category& category : categoryRepository.getAllProfileCategories(lookup.profileId)) {
+        lookup.categoryIds.insert(category.getCategoryName(), category.getCategoryId());
+    }
+}
+
+void CsvImporter::loadAccounts(ProfileLookup& lookup) const
+{
+    lookup.accountIds.clear();
+    for (const FinancialAccount& account : financialAccountRepository.getAllProfileFinancialAccounts(lookup.profileId)) {
+        lookup.accountIds.insert(account.getFinancialAccountName(), account.getFinancialAccountId());
+    }
+}
+
+QDate CsvImporter::parseDate(const QByteArray& text)
+{
+    if (text.size() != 10 || text.at(4) != '-' || text.at(7) != '-') return QDate();
+
+    auto number = [&text](int from, int length) {
+        int value = 0;
+        for (int i = from; i < from + length; ++i) {
+            const char c = text.at(i);
+            if (c < '0' || c > '9') return -1;
+            value = value * 10 + (c - '0');
+        }
+        return value;
+    };
+
+    const int year = number(0, 4);
+    const int month = number(5, 2);
+    const int day = number(8, 2);
+    if (year < 0 || month < 0 || day < 0) return QDate();
+    return QDate(year, month, day);
+}
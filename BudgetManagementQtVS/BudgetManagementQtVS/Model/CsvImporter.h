@@ -0,0 +1,138 @@
+/**
+ * @file CsvImporter.h
+ * @brief Header file for the streaming CSV importer.
+ */
+#pragma once
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+
+#include "Model/Transaction.h"
+#include "Model/Repositories/ProfileRepository.h"
+#include "Model/Repositories/TransactionRepository.h"
+#include "Model/Repositories/CategoryRepository.h"
+#include "Model/Repositories/FinancialAccountRepository.h"
+
+ /**
+  * @class CsvImporter
+  * @brief Reads files in the column layout written by CsvExporter and inserts them as new transactions.
+  * The file is parsed in fixed-size chunks into a reused buffer, so memory use does not grow with file size.
+  * Profiles, categories and accounts are resolved by name through per-profile lookup caches and created when missing.
+  * Rows are written in batches, one database transaction per batch.
+  */
+class CsvImporter
+{
+public:
+    /**
+     * @brief Called after every chunk and every written batch.
+     * @param bytesRead Bytes consumed so far.
+     * @param totalBytes File size.
+     * @param rowsImported Rows committed so far.
+     * @return False to cancel. Batches already committed are kept.
+     */
+    using ProgressCallback = std::function<bool(qint64 bytesRead, qint64 totalBytes, int rowsImported)>;
+
+    /**
+     * @struct Result
+     * @brief Summary of one import run.
+     */
+    struct Result
+    {
+        int importedCount = 0;      ///< Rows committed.
+        int rejectedCount = 0;      ///< Rows skipped because they were malformed or failed to insert.
+        QStringList errors;         ///< First maxReportedErrors row errors, prefixed with the line number.
+        bool cancelled = false;     ///< True if the progress callback stopped the import.
+        QString fatalError;         ///< Set if the file could not be read at all; nothing was imported.
+    };
+
+    /**
+     * @brief Constructs an importer for one user's data.
+     * @param profileRepo Repository used to find or create profiles by name.
+     * @param userId Owner of the imported profiles.
+     */
+    CsvImporter(ProfilesRepository& profileRepo, int userId);
+
+    /**
+     * @brief Imports a file. Transaction IDs in the file are ignored; every row gets a new ID.
+     * @param filePath Path of the CSV file.
+     * @param progress Optional progress/cancellation callback.
+     * @return Import summary.
+     */
+    Result importFile(const QString& filePath, const ProgressCallback& progress = ProgressCallback());
+
+private:
+    static constexpr qint64 chunkSize = 1 << 20;        ///< Bytes read from the file per call.
+    static constexpr int batchSize = 5000;              ///< Rows per database transaction.
+    static constexpr int maxReportedErrors = 50;        ///< Row errors kept in Result::errors.
+    static constexpr int columnCount = 10;              ///< Fields per record.
+
+    /**
+     * @struct ProfileLookup
+     * @brief Name-to-ID caches for one profile.
+     */
+    struct ProfileLookup
+    {
+        int profileId = -1;
+        QHash<QString, int> categoryIds;    ///< Category name -> ID.
+        QHash<QString, int> accountIds;     ///< Account name -> ID.
+    };
+
+    ProfilesRepository& profileRepository;
+    TransactionRepository transactionRepository;
+    CategoryRepository categoryRepository;
+    FinancialAccountRepository financialAccountRepository;
+    int userId;
+
+    QVector<ProfileLookup> lookups;                 ///< One entry per profile seen in the file.
+    QHash<QString, qsizetype> lookupIndexByName;    ///< Profile name -> index in lookups.
+    qsizetype lastLookupIndex = -1;                 ///< Rows are grouped by profile, so this usually hits.
+    QString lastProfileName;
+
+    QVector<QByteArray> fields;     ///< Fields of the record being parsed; buffers are reused between records.
+    int fieldCount = 0;             ///< Number of fields filled in the current record.
+    bool headerSeen = false;
+
+    QVector<Transaction> batch;     ///< Parsed rows waiting to be written.
+    QVector<qint64> batchLines;     ///< Source line of each row in batch.
+
+    Result result;
+
+    /** @brief Resets parser, caches and result for a new run. */
+    void reset();
+
+    /**
+     * @brief Handles one complete record.
+     * @param line Line the record starts on.
+     */
+    void processRecord(qint64 line);
+
+    /** @brief Writes the pending batch. */
+    void flushBatch();
+
+    /** @brief Records a rejected row, keeping only the first maxReportedErrors messages. */
+    void reject(qint64 line, const QString& message);
+
+    /**
+     * @brief Finds or creates the profile with the given name and returns its lookup caches.
+     * @return Null if the profile could not be created.
+     */
+    ProfileLookup* resolveProfile(const QString& profileName);
+
+    /** @brief Returns the ID of a category, creating it if missing, or -1 on failure. */
+    int resolveCategory(ProfileLookup& lookup, const QString& categoryName);
+
+    /** @brief Returns the ID of an account, creating it if missing, or -1 on failure. */
+    int resolveAccount(ProfileLookup& lookup, const QString& accountName, const QString& accountType);
+
+    /** @brief Reloads the category cache of a profile. */
+    void loadCategories(ProfileLookup& lookup) const;
+
+    /** @brief Reloads the account cache of a profile. */
+    void loadAccounts(ProfileLookup& lookup) const;
+
+    /** @brief Parses a yyyy-MM-dd date without going through QDate::fromString. */
+    static QDate parseDate(const QByteArray& text);
+};
@@ -3,23 +3,27 @@
  * @brief Implementation of the Database Manager.
  */
 #include "DatabaseManager.h"
+#include <Model/Repositories/StatementCache.h>
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QDebug>
 #include <QCryptographicHash>
 #include <QUuid>
+#include <QElapsedTimer>
+#include <QSettings>
 
  /**
   * @brief Constructor.
   * - Opens the SQLite database connection.
-  * - Enables foreign keys.
+  * - Enables foreign keys and applies the SQLite performance profile.
   * - Creates necessary tables (users, profiles, categories, financialAccount, transactions) if they don't exist.
   * - Inserts default 'None' records.
+  * - Upgrades the schema in place by running pending migrations.
   * - Creates a default admin user for development purposes.
   */
-DatabaseManager::DatabaseManager() {
+DatabaseManager::DatabaseManager() : profile(loadPerformanceProfile()), ownerThread(QThread::currentThread()), nextConnectionId(0) {
     datebaseInstance = QSqlDatabase::addDatabase("QSQLITE");
-    datebaseInstance.setDatabaseName("BudgetDatabase.db");
+    datebaseInstance.setDatabaseName(databasePath);
 
     if (!datebaseInstance.open()) {
         qDebug() << "Database Error:" << datebaseInstance.lastError().text();
@@ -28,9 +32,9 @@ DatabaseManager::DatabaseManager() {
         qDebug() << "Database opened correctly.";
     }
 
-    QSqlQuery tableCreationQuery;
+    configureConnection(datebaseInstance);
 
-    tableCreationQuery.exec("PRAGMA foreign_keys = ON;");
+    QSqlQuery tableCreationQuery;
 
     tableCreationQuery.exec("CREATE TABLE IF NOT EXISTS users"
         "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
@@ -81,14 +85,526 @@ DatabaseManager::DatabaseManager() {
         "FOREIGN KEY (financialAccount_id) REFERENCES financialAccount(id) ON DELETE SET DEFAULT"
         ")");
 
-    
+    runMigrations();
+}
+/** @brief Preset favouring durability: every commit is synced to disk. */
+DatabaseManager::PerformanceProfile DatabaseManager::PerformanceProfile::durable()
+{
+    return { "durable", "WAL", "FULL", 0, -2000, "DEFAULT", 5000 };
+}
+/** @brief Preset favouring throughput: commits are synced at WAL checkpoints only. */
+DatabaseManager::PerformanceProfile DatabaseManager::PerformanceProfile::fast()
+{
+    return { "fast", "WAL", "NORMAL", 268435456, -65536, "MEMORY", 5000 };
+}
+/** @brief Resolves the preset from the environment or BudgetDatabase.ini and applies per-pragma overrides. */
+DatabaseManager::PerformanceProfile DatabaseManager::loadPerformanceProfile()
+{
+    QSettings settings("BudgetDatabase.ini", QSettings::IniFormat);
+    settings.beginGroup("database");
+
+    QString presetName = qEnvironmentVariable("BMA_DB_PROFILE");
+    if (presetName.isEmpty()) {
+        presetName = settings.value("profile", "durable").toString();
+    }
+
+    PerformanceProfile selected = PerformanceProfile::durable();
+    if (presetName.compare("fast", Qt::CaseInsensitive) == 0) {
+        selected = PerformanceProfile::fast();
+    }
+    else if (presetName.compare("durable", Qt::CaseInsensitive) != 0) {
+        qDebug() << "Unknown database profile" << presetName << "- falling back to" << selected.name;
+    }
+
+    selected.journalMode = settings.value("journal_mode", selected.journalMode).toString();
+    selected.synchronous = settings.value("synchronous", selected.synchronous).toString();
+    selected.mmapSize = settings.value("mmap_size", selected.mmapSize).toLongLong();
+    selected.cacheSize = settings.value("cache_size", selected.cacheSize).toInt();
+    selected.tempStore = settings.value("temp_store", selected.tempStore).toString();
+    selected.busyTimeoutMs = settings.value("busy_timeout", selected.busyTimeoutMs).toInt();
+
+    settings.endGroup();
+    return selected;
+}
+/** @brief Applies foreign key enforcement and the performance profile pragmas to a connection. */
+void DatabaseManager::configureConnection(QSqlDatabase& connection) const
+{
+    QSqlQuery pragmaQuery(connection);
+    const QStringList pragmas = {
+        "PRAGMA foreign_keys = ON",
+        QString("PRAGMA busy_timeout = %1").arg(profile.busyTimeoutMs),
+        QString("PRAGMA journal_mode = %1").arg(profile.journalMode),
+        QString("PRAGMA synchronous = %1").arg(profile.synchronous),
+        QString("PRAGMA mmap_size = %1").arg(profile.mmapSize),
+        QString("PRAGMA cache_size = %1").arg(profile.cacheSize),
+        QString("PRAGMA temp_store = %1").arg(profile.tempStore)
+    };
+
+    for (const QString& pragma : pragmas) {
+        if (!pragmaQuery.exec(pragma)) {
+            qDebug() << "Database pragma failed:" << pragma << pragmaQuery.lastError().text();
+        }
+    }
+    pragmaQuery.finish();
+
+    qDebug() << "Database performance profile:" << profile.name
+        << "journal_mode =" << profile.journalMode << "synchronous =" << profile.synchronous;
+}
+/**
+ * @brief Ordered list of schema migrations. Append new entries at the end with the next version number;
+ * never edit an entry that has already shipped.
+ */
+const QVector<DatabaseManager::Migration>& DatabaseManager::migrations()
+{
+    static const QVector<Migration> allMigrations = {
+        { 1, "Add covering indexes for profile, category and account lookups", {
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_type_date ON transactions (profile_id, type, date, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_category ON transactions (profile_id, category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_category ON transactions (category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_account ON transactions (financialAccount_id, type, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_category_profile ON category (profile_id)",
+            "CREATE INDEX IF NOT EXISTS idx_financialAccount_profile ON financialAccount (profile_id)",
+            "CREATE INDEX IF NOT EXISTS idx_profiles_user ON profiles (user_id)"
+        } },
+        { 2, "Store amounts, balances and budget limits as INTEGER minor units", {
+            "CREATE TABLE profiles_new"
+            "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "profile_name TEXT NOT NULL CHECK (profile_name != ''), "
+            "user_id INTEGER NOT NULL, "
+            "budget_limit INTEGER DEFAULT 0, "
+            "FOREIGN KEY(user_id) REFERENCES users(id) ON DELETE CASCADE)",
+            "INSERT INTO profiles_new (id, profile_name, user_id, budget_limit) "
+            "SELECT id, profile_name, user_id, CAST(ROUND(COALESCE(budget_limit, 0) * 100) AS INTEGER) FROM profiles",
+            "DROP TABLE profiles",
+            "ALTER TABLE profiles_new RENAME TO profiles",
+            "CREATE INDEX IF NOT EXISTS idx_profiles_user ON profiles (user_id)",
+
+            "CREATE TABLE financialAccount_new"
+            "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "financialAccount_name TEXT NOT NULL CHECK (financialAccount_name != ''), "
+            "financialAccount_type TEXT NOT NULL, "
+            "financialAccount_balance INTEGER DEFAULT 0, "
+            "profile_id INTEGER, "
+            "FOREIGN KEY (profile_id) REFERENCES profiles(id) ON DELETE CASCADE)",
+            "INSERT INTO financialAccount_new (id, financialAccount_name, financialAccount_type, financialAccount_balance, profile_id) "
+            "SELECT id, financialAccount_name, financialAccount_type, CAST(ROUND(COALESCE(financialAccount_balance, 0) * 100) AS INTEGER), profile_id FROM financialAccount",
+            "DROP TABLE financialAccount",
+            "ALTER TABLE financialAccount_new RENAME TO financialAccount",
+            "CREATE INDEX IF NOT EXISTS idx_financialAccount_profile ON financialAccount (profile_id)",
+
+            "CREATE TABLE transactions_new"
+            "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "name TEXT NOT NULL CHECK (name != ''), "
+            "type TEXT NOT NULL CHECK (type != ''), "
+            "date TEXT NOT NULL CHECK (date != ''), "
+            "description TEXT, "
+            "amount INTEGER NOT NULL, "
+            "category_id INTEGER DEFAULT 1, "
+            "financialAccount_id INTEGER DEFAULT 1, "
+            "profile_id INTEGER, "
+            "FOREIGN KEY (profile_id) REFERENCES profiles(id) ON DELETE CASCADE, "
+            "FOREIGN KEY (category_id) REFERENCES category(id) ON DELETE SET DEFAULT, "
+            "FOREIGN KEY (financialAccount_id) REFERENCES financialAccount(id) ON DELETE SET DEFAULT)",
+            "INSERT INTO transactions_new (id, name, type, date, description, amount, category_id, financialAccount_id, profile_id) "
+            "SELECT id, name, type, date, description, CAST(ROUND(amount * 100) AS INTEGER), category_id, financialAccount_id, profile_id FROM transactions",
+            "DROP TABLE transactions",
+            "ALTER TABLE transactions_new RENAME TO transactions",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_type_date ON transactions (profile_id, type, date, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_category ON transactions (profile_id, category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_category ON transactions (category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_account ON transactions (financialAccount_id, type, amount)"
+        } },
+        { 3, "Store transaction type as INTEGER (0 = Expense, 1 = Income)", {
+            "CREATE TABLE transactions_new"
+            "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "name TEXT NOT NULL CHECK (name != ''), "
+            "type INTEGER NOT NULL CHECK (type IN (0, 1)), "
+            "date TEXT NOT NULL CHECK (date != ''), "
+            "description TEXT, "
+            "amount INTEGER NOT NULL, "
+            "category_id INTEGER DEFAULT 1, "
+            "financialAccount_id INTEGER DEFAULT 1, "
+            "profile_id INTEGER, "
+            "FOREIGN KEY (profile_id) REFERENCES profiles(id) ON DELETE CASCADE, "
+            "FOREIGN KEY (category_id) REFERENCES category(id) ON DELETE SET DEFAULT, "
+            "FOREIGN KEY (financialAccount_id) REFERENCES financialAccount(id) ON DELETE SET DEFAULT)",
+            "INSERT INTO transactions_new (id, name, type, date, description, amount, category_id, financialAccount_id, profile_id) "
+            "SELECT id, name, CASE WHEN UPPER(TRIM(type)) = 'INCOME' THEN 1 ELSE 0 END, date, description, amount, category_id, financialAccount_id, profile_id FROM transactions",
+            "DROP TABLE transactions",
+            "ALTER TABLE transactions_new RENAME TO transactions",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_type_date ON transactions (profile_id, type, date, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_category ON transactions (profile_id, category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_category ON transactions (category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_account ON transactions (financialAccount_id, type, amount)"
+        } },
+        { 4, "Store transaction dates as INTEGER Julian day numbers", {
+            "CREATE TABLE transactions_new"
+            "(id INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "name TEXT NOT NULL CHECK (name != ''), "
+            "type INTEGER NOT NULL CHECK (type IN (0, 1)), "
+            "date INTEGER NOT NULL CHECK (date > 0), "
+            "description TEXT, "
+            "amount INTEGER NOT NULL, "
+            "category_id INTEGER DEFAULT 1, "
+            "financialAccount_id INTEGER DEFAULT 1, "
+            "profile_id INTEGER, "
+            "FOREIGN KEY (profile_id) REFERENCES profiles(id) ON DELETE CASCADE, "
+            "FOREIGN KEY (category_id) REFERENCES category(id) ON DELETE SET DEFAULT, "
+            "FOREIGN KEY (financialAccount_id) REFERENCES financialAccount(id) ON DELETE SET DEFAULT)",
+            // QDate::toJulianDay() counts from midnight, SQLite's julianday() from noon; unparsable dates fall back to today.
+            "INSERT INTO transactions_new (id, name, type, date, description, amount, category_id, financialAccount_id, profile_id) "
+            "SELECT id, name, type, CAST(COALESCE(julianday(date), julianday('now', 'localtime', 'start of day')) + 0.5 AS INTEGER), "
+            "description, amount, category_id, financialAccount_id, profile_id FROM transactions",
+            "DROP TABLE transactions",
+            "ALTER TABLE transactions_new RENAME TO transactions",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_type_date ON transactions (profile_id, type, date, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_category ON transactions (profile_id, category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_category ON transactions (category_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_account ON transactions (financialAccount_id, type, amount)"
+        } },
+        { 5, "Add FTS5 full-text index over transaction text and category/account names", {
+            "CREATE VIRTUAL TABLE IF NOT EXISTS transactions_fts USING fts5("
+            "name, description, category_name, account_name, "
+            "tokenize = 'unicode61 remove_diacritics 2', prefix = '2 3')",
+            "INSERT INTO transactions_fts (rowid, name, description, category_name, account_name) "
+            "SELECT t.id, t.name, COALESCE(t.description, ''), COALESCE(c.category_name, ''), COALESCE(fa.financialAccount_name, '') "
+            "FROM transactions t "
+            "LEFT JOIN category c ON c.id = t.category_id "
+            "LEFT JOIN financialAccount fa ON fa.id = t.financialAccount_id",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_fts_insert AFTER INSERT ON transactions BEGIN "
+            "INSERT INTO transactions_fts (rowid, name, description, category_name, account_name) VALUES (new.id, new.name, COALESCE(new.description, ''), "
+            "COALESCE((SELECT category_name FROM category WHERE id = new.category_id), ''), "
+            "COALESCE((SELECT financialAccount_name FROM financialAccount WHERE id = new.financialAccount_id), '')); "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_fts_delete AFTER DELETE ON transactions BEGIN "
+            "DELETE FROM transactions_fts WHERE rowid = old.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_fts_update AFTER UPDATE OF name, description, category_id, financialAccount_id ON transactions BEGIN "
+            "UPDATE transactions_fts SET name = new.name, description = COALESCE(new.description, ''), "
+            "category_name = COALESCE((SELECT category_name FROM category WHERE id = new.category_id), ''), "
+            "account_name = COALESCE((SELECT financialAccount_name FROM financialAccount WHERE id = new.financialAccount_id), '') "
+            "WHERE rowid = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_category_fts_rename AFTER UPDATE OF category_name ON category BEGIN "
+            "UPDATE transactions_fts SET category_name = new.category_name "
+            "WHERE rowid IN (SELECT id FROM transactions WHERE category_id = new.id); "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_financialAccount_fts_rename AFTER UPDATE OF financialAccount_name ON financialAccount BEGIN "
+            "UPDATE transactions_fts SET account_name = new.financialAccount_name "
+            "WHERE rowid IN (SELECT id FROM transactions WHERE financialAccount_id = new.id); "
+            "END"
+        } },
+        { 6, "Add monthly_rollup aggregate table maintained by triggers", {
+            "CREATE TABLE IF NOT EXISTS monthly_rollup"
+            "(profile_id INTEGER NOT NULL, "
+            "year_month INTEGER NOT NULL, "
+            "type INTEGER NOT NULL, "
+            "category_id INTEGER NOT NULL, "
+            "account_id INTEGER NOT NULL, "
+            "total INTEGER NOT NULL, "
+            "count INTEGER NOT NULL, "
+            "PRIMARY KEY (profile_id, type, year_month, category_id, account_id)) WITHOUT ROWID",
+            "INSERT INTO monthly_rollup (profile_id, year_month, type, category_id, account_id, total, count) "
+            "SELECT profile_id, CAST(strftime('%Y%m', date - 0.5) AS INTEGER), type, COALESCE(category_id, 1), COALESCE(financialAccount_id, 1), SUM(amount), COUNT(*) "
+            "FROM transactions WHERE profile_id IS NOT NULL GROUP BY 1, 2, 3, 4, 5",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_rollup_insert AFTER INSERT ON transactions WHEN new.profile_id IS NOT NULL BEGIN "
+            "INSERT INTO monthly_rollup (profile_id, year_month, type, category_id, account_id, total, count) "
+            "VALUES (new.profile_id, CAST(strftime('%Y%m', new.date - 0.5) AS INTEGER), new.type, COALESCE(new.category_id, 1), COALESCE(new.financialAccount_id, 1), new.amount, 1) "
+            "ON CONFLICT (profile_id, type, year_month, category_id, account_id) DO UPDATE SET total = total + excluded.total, count = count + 1; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_rollup_delete AFTER DELETE ON transactions WHEN old.profile_id IS NOT NULL BEGIN "
+            "UPDATE monthly_rollup SET total = total - old.amount, count = count - 1 "
+            "WHERE profile_id = old.profile_id AND year_month = CAST(strftime('%Y%m', old.date - 0.5) AS INTEGER) AND type = old.type AND category_id = COALESCE(old.category_id, 1) AND account_id = COALESCE(old.financialAccount_id, 1); "
+            "DELETE FROM monthly_rollup "
+            "WHERE profile_id = old.profile_id AND year_month = CAST(strftime('%Y%m', old.date - 0.5) AS INTEGER) AND type = old.type AND category_id = COALESCE(old.category_id, 1) AND account_id = COALESCE(old.financialAccount_id, 1) AND count <= 0; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_rollup_update AFTER UPDATE OF profile_id, date, type, amount, category_id, financialAccount_id ON transactions BEGIN "
+            "UPDATE monthly_rollup SET total = total - old.amount, count = count - 1 "
+            "WHERE profile_id = old.profile_id AND year_month = CAST(strftime('%Y%m', old.date - 0.5) AS INTEGER) AND type = old.type AND category_id = COALESCE(old.category_id, 1) AND account_id = COALESCE(old.financialAccount_id, 1); "
+            "DELETE FROM monthly_rollup "
+            "WHERE profile_id = old.profile_id AND year_month = CAST(strftime('%Y%m', old.date - 0.5) AS INTEGER) AND type = old.type AND category_id = COALESCE(old.category_id, 1) AND account_id = COALESCE(old.financialAccount_id, 1) AND count <= 0; "
+            "INSERT INTO monthly_rollup (profile_id, year_month, type, category_id, account_id, total, count) "
+            "SELECT new.profile_id, CAST(strftime('%Y%m', new.date - 0.5) AS INTEGER), new.type, COALESCE(new.category_id, 1), COALESCE(new.financialAccount_id, 1), new.amount, 1 WHERE new.profile_id IS NOT NULL "
+            "ON CONFLICT (profile_id, type, year_month, category_id, account_id) DO UPDATE SET total = total + excluded.total, count = count + 1; "
+            "END"
+        } },
+        { 7, "Store a running current_balance per financial account, maintained by triggers", {
+            "ALTER TABLE financialAccount ADD COLUMN current_balance INTEGER NOT NULL DEFAULT 0",
+            "UPDATE financialAccount SET current_balance = financialAccount_balance + COALESCE((SELECT SUM(CASE WHEN t.type = 1 THEN t.amount ELSE -t.amount END) "
+            "FROM transactions t WHERE t.financialAccount_id = financialAccount.id), 0)",
+            "CREATE TRIGGER IF NOT EXISTS trg_financialAccount_balance_insert AFTER INSERT ON financialAccount BEGIN "
+            "UPDATE financialAccount SET current_balance = new.financialAccount_balance WHERE id = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_financialAccount_balance_update AFTER UPDATE OF financialAccount_balance ON financialAccount BEGIN "
+            "UPDATE financialAccount SET current_balance = current_balance + new.financialAccount_balance - old.financialAccount_balance WHERE id = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_balance_insert AFTER INSERT ON transactions BEGIN "
+            "UPDATE financialAccount SET current_balance = current_balance + (CASE WHEN new.type = 1 THEN new.amount ELSE -new.amount END) WHERE id = new.financialAccount_id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_balance_delete AFTER DELETE ON transactions BEGIN "
+            "UPDATE financialAccount SET current_balance = current_balance - (CASE WHEN old.type = 1 THEN old.amount ELSE -old.amount END) WHERE id = old.financialAccount_id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_balance_update AFTER UPDATE OF type, amount, financialAccount_id ON transactions BEGIN "
+            "UPDATE financialAccount SET current_balance = current_balance - (CASE WHEN old.type = 1 THEN old.amount ELSE -old.amount END) WHERE id = old.financialAccount_id; "
+            "UPDATE financialAccount SET current_balance = current_balance + (CASE WHEN new.type = 1 THEN new.amount ELSE -new.amount END) WHERE id = new.financialAccount_id; "
+            "END"
+        } },
+        // op: 0 = transaction written, 1 = transaction deleted, 2 = profile deleted (profile_name set, transaction_id NULL).
+        // Renames log every affected transaction so the autosave rewrites their names.
+        { 8, "Add change_log recording transaction changes for incremental autosave", {
+            "CREATE TABLE IF NOT EXISTS change_log "
+            "(seq INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "user_id INTEGER NOT NULL, "
+            "op INTEGER NOT NULL CHECK (op IN (0, 1, 2)), "
+            "transaction_id INTEGER, "
+            "profile_name TEXT)",
+            "CREATE INDEX IF NOT EXISTS idx_change_log_user ON change_log (user_id, seq)",
+            "CREATE INDEX IF NOT EXISTS idx_change_log_transaction ON change_log (transaction_id, seq)",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_changelog_insert AFTER INSERT ON transactions BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT user_id, 0, new.id FROM profiles WHERE id = new.profile_id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_changelog_update AFTER UPDATE ON transactions BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT user_id, 0, new.id FROM profiles WHERE id = new.profile_id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_transactions_changelog_delete AFTER DELETE ON transactions BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT user_id, 1, old.id FROM profiles WHERE id = old.profile_id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_profiles_changelog_delete BEFORE DELETE ON profiles BEGIN "
+            "INSERT INTO change_log (user_id, op, profile_name) VALUES (old.user_id, 2, old.profile_name); "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_profiles_changelog_rename AFTER UPDATE OF profile_name ON profiles "
+            "WHEN new.profile_name IS NOT old.profile_name BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT new.user_id, 0, id FROM transactions WHERE profile_id = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_category_changelog_rename AFTER UPDATE OF category_name ON category "
+            "WHEN new.category_name IS NOT old.category_name BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT p.user_id, 0, t.id FROM transactions t "
+            "JOIN profiles p ON p.id = t.profile_id WHERE t.category_id = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_financialAccount_changelog_rename AFTER UPDATE OF financialAccount_name, financialAccount_type ON financialAccount "
+            "WHEN new.financialAccount_name IS NOT old.financialAccount_name OR new.financialAccount_type IS NOT old.financialAccount_type BEGIN "
+            "INSERT INTO change_log (user_id, op, transaction_id) SELECT p.user_id, 0, t.id FROM transactions t "
+            "JOIN profiles p ON p.id = t.profile_id WHERE t.financialAccount_id = new.id; "
+            "END",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_changelog_delete AFTER DELETE ON users BEGIN "
+            "DELETE FROM change_log WHERE user_id = old.id; "
+            "END"
+        } },
+        // Each index ends in the implicit rowid (= transactions.id), so (sort column, id) keysets are index range scans.
+        { 9, "Add per-profile sort indexes for keyset-paginated transaction listing", {
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile ON transactions (profile_id)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_date ON transactions (profile_id, date)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_amount ON transactions (profile_id, amount)",
+            "CREATE INDEX IF NOT EXISTS idx_transactions_profile_name ON transactions (profile_id, name COLLATE NOCASE)"
+        } },
+    };
+    return allMigrations;
+}
+/** @brief Reads PRAGMA user_version. */
+int DatabaseManager::schemaVersion() const
+{
+    QSqlQuery query(datebaseInstance);
+    if (query.exec("PRAGMA user_version") && query.next()) {
+        return query.value(0).toInt();
+    }
+    return 0;
+}
+/** @brief Counts rows reported by PRAGMA foreign_key_check. */
+int DatabaseManager::foreignKeyViolationCount() const
+{
+    QSqlQuery query(datebaseInstance);
+    if (query.exec("SELECT COUNT(*) FROM pragma_foreign_key_check") && query.next()) {
+        return query.value(0).toInt();
+    }
+    return 0;
+}
+/**
+ * @brief Runs every pending migration in order, logging the time each one takes.
+ * Foreign keys are switched off for the duration so migrations may rebuild tables.
+ * Later migrations build on earlier ones, so the first failure stops the upgrade and is recorded in schemaError.
+ */
+bool DatabaseManager::runMigrations()
+{
+    const int currentVersion = schemaVersion();
+    const QVector<Migration>& allMigrations = migrations();
+    const int latestVersion = allMigrations.isEmpty() ? 0 : allMigrations.last().version;
+
+    if (currentVersion >= latestVersion) {
+        qDebug() << "Database schema is up to date (version" << currentVersion << ").";
+        return true;
+    }
+
+    qDebug() << "Upgrading database schema from version" << currentVersion << "to" << latestVersion;
+
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    QSqlQuery pragmaQuery(datebaseInstance);
+    pragmaQuery.exec("PRAGMA foreign_keys = OFF;");
+
+    for (const Migration& migration : allMigrations) {
+        if (migration.version <= currentVersion) continue;
+        if (!applyMigration(migration)) {
+            schemaError = QString("Migration %1 (%2) failed; the database is at schema version %3 of %4.")
+                .arg(migration.version).arg(migration.description).arg(schemaVersion()).arg(latestVersion);
+            qDebug() << "Database migration stopped:" << schemaError;
+            break;
+        }
+    }
+
+    pragmaQuery.exec("PRAGMA foreign_keys = ON;");
+
+    qDebug() << "Database schema upgrade finished in" << totalTimer.elapsed() << "ms.";
+    return schemaError.isEmpty();
+}
+/**
+ * @brief Executes the migration statements in a single transaction, verifies foreign keys and stores the new version.
+ * Violations that already existed before the migration are tolerated; new ones roll it back.
+ */
+bool DatabaseManager::applyMigration(const Migration& migration)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const int violationsBefore = foreignKeyViolationCount();
+
+    if (!datebaseInstance.transaction()) {
+        qDebug() << "Migration" << migration.version << "could not start a transaction:" << datebaseInstance.lastError().text();
+        return false;
+    }
+
+    QSqlQuery query(datebaseInstance);
+    for (const QString& statement : migration.statements) {
+        if (!query.exec(statement)) {
+            qDebug() << "Migration" << migration.version << "failed:" << query.lastError().text() << "in" << statement;
+            datebaseInstance.rollback();
+            return false;
+        }
+    }
+
+    const int violationsAfter = foreignKeyViolationCount();
+    if (violationsAfter > violationsBefore) {
+        qDebug() << "Migration" << migration.version << "introduced" << (violationsAfter - violationsBefore) << "foreign key violations.";
+        datebaseInstance.rollback();
+        return false;
+    }
+
+    if (!query.exec(QString("PRAGMA user_version = %1").arg(migration.version))) {
+        qDebug() << "Migration" << migration.version << "could not store schema version:" << query.lastError().text();
+        datebaseInstance.rollback();
+        return false;
+    }
+
+    if (!datebaseInstance.commit()) {
+        qDebug() << "Migration" << migration.version << "commit failed:" << datebaseInstance.lastError().text();
+        datebaseInstance.rollback();
+        return false;
+    }
+
+    qDebug() << "Applied migration" << migration.version << "(" << migration.description << ") in" << timer.elapsed() << "ms.";
+    return true;
+}
+/** @brief Finalizes the main connection's cached statements before the connection itself goes away. */
+DatabaseManager::~DatabaseManager()
+{
+    mainStatements.reset();
 }
 /** @brief Returns the static singleton instance. */
 DatabaseManager& DatabaseManager::instance() {
     static DatabaseManager instance;
     return instance;
 }
-/** @brief Returns the internal QSqlDatabase instance. */
+/** @brief Stores the path used when the singleton is first created. */
+void DatabaseManager::setDatabasePath(const QString& path)
+{
+    databasePath = path;
+}
+bool DatabaseManager::isSchemaCurrent() const
+{
+    return schemaError.isEmpty();
+}
+
+QString DatabaseManager::getSchemaError() const
+{
+    return schemaError;
+}
+/** @brief Returns the active performance profile. */
+const DatabaseManager::PerformanceProfile& DatabaseManager::performanceProfile() const
+{
+    return profile;
+}
+/** @brief Opens the main database file under a new connection name and applies the same PRAGMA setup. */
+QSqlDatabase DatabaseManager::openConnection(const QString& connectionName) const
+{
+    QSqlDatabase connection = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    connection.setDatabaseName(datebaseInstance.databaseName());
+
+    if (!connection.open()) {
+        qDebug() << "Database Error (" << connectionName << "):" << connection.lastError().text();
+        return connection;
+    }
+
+    configureConnection(connection);
+    return connection;
+}
+/** @brief Closes the connection before removing it from Qt's registry. */
+void DatabaseManager::closeConnection(const QString& connectionName)
+{
+    {
+        QSqlDatabase connection = QSqlDatabase::database(connectionName, false);
+        if (connection.isOpen()) {
+            connection.close();
+        }
+    }
+    QSqlDatabase::removeDatabase(connectionName);
+}
+/**
+ * @brief Returns the main connection on the owner thread. Other threads get a connection stored in
+ * threadConnections, so repeated calls and every repository on that thread share it.
+ */
 QSqlDatabase& DatabaseManager::database() {
-    return datebaseInstance;
+    if (QThread::currentThread() == ownerThread) {
+        return datebaseInstance;
+    }
+    return threadConnection()->connection;
+}
+/** @brief Returns the cache matching the connection database() returns on this thread. */
+StatementCache& DatabaseManager::statementCache() {
+    if (QThread::currentThread() == ownerThread) {
+        if (!mainStatements) {
+            mainStatements = std::make_unique<StatementCache>(datebaseInstance);
+        }
+        return *mainStatements;
+    }
+    return *threadConnection()->statements;
+}
+
+DatabaseManager::ThreadConnection* DatabaseManager::threadConnection() {
+    ThreadConnection* threadConnection = threadConnections.localData();
+    if (!threadConnection) {
+        threadConnection = new ThreadConnection;
+        threadConnection->name = QString("bma_thread_%1").arg(nextConnectionId.fetchAndAddRelaxed(1));
+        threadConnection->connection = openConnection(threadConnection->name);
+        threadConnection->statements = std::make_unique<StatementCache>(threadConnection->connection);
+        threadConnections.setLocalData(threadConnection);
+        liveThreadConnections.ref();
+        qDebug() << "Opened database connection" << threadConnection->name << "for thread" << QThread::currentThread()->objectName();
+    }
+    return threadConnection;
+}
+
+QAtomicInt DatabaseManager::liveThreadConnections(0);
+QString DatabaseManager::databasePath = QStringLiteral("BudgetDatabase.db");
+
+int DatabaseManager::threadConnectionCount() const
+{
+    return liveThreadConnections.loadRelaxed();
+}
+/** @brief Runs on the exiting thread; drops the handle before unregistering the name. */
+DatabaseManager::ThreadConnection::~ThreadConnection()
+{
+    statements.reset();
+    connection = QSqlDatabase();
+    closeConnection(name);
+    liveThreadConnections.deref();
 }
\ No newline at end of file
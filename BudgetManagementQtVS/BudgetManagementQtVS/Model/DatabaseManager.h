@@ -4,13 +4,43 @@
  */
 #pragma once
 #include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QThread>
+#include <QThreadStorage>
+#include <QAtomicInteger>
+#include <memory>
+
+class StatementCache;
 
  /**
   * @class DatabaseManager
-  * @brief Singleton class responsible for initializing and managing the SQLite database connection.
+  * @brief Singleton class responsible for initializing and managing the SQLite database connections.
+  * The thread that creates the singleton uses the main connection; every other thread gets its own named
+  * connection on first use, configured identically and closed automatically when the thread exits.
   */
 class DatabaseManager {
 public:
+    /**
+     * @struct PerformanceProfile
+     * @brief SQLite tuning applied to every connection (journaling, syncing and cache sizing).
+     */
+    struct PerformanceProfile {
+        QString name;               ///< Preset name ("durable" or "fast").
+        QString journalMode;        ///< PRAGMA journal_mode value.
+        QString synchronous;        ///< PRAGMA synchronous value.
+        qint64 mmapSize;            ///< PRAGMA mmap_size in bytes (0 disables memory mapping).
+        int cacheSize;              ///< PRAGMA cache_size (negative values are KiB).
+        QString tempStore;          ///< PRAGMA temp_store value.
+        int busyTimeoutMs;          ///< PRAGMA busy_timeout in milliseconds.
+
+        /** @brief WAL with a full sync on every commit. Survives power loss without losing committed data. */
+        static PerformanceProfile durable();
+        /** @brief WAL with synchronous=NORMAL, memory mapping and a large page cache. Optimized for bulk writes. */
+        static PerformanceProfile fast();
+    };
+
     /**
      * @brief Accesses the single instance of the DatabaseManager.
      * @return Reference to the singleton instance.
@@ -18,12 +48,130 @@ public:
     static DatabaseManager& instance();
 
     /**
-     * @brief Provides access to the QSqlDatabase object.
-     * @return Reference to the active database connection.
+     * @brief Chooses the database file opened by the singleton. Defaults to BudgetDatabase.db in the working directory.
+     * Has no effect once instance() has been called.
+     * @param path Path of the SQLite file; created if it does not exist.
+     */
+    static void setDatabasePath(const QString& path);
+
+    /**
+     * @brief Provides the connection of the calling thread, opening it on first use.
+     * QSqlDatabase connections must only be used on the thread that opened them.
+     * @return Reference to the calling thread's connection; valid until that thread exits.
      */
     QSqlDatabase& database();
+
+    /**
+     * @brief Provides the prepared statement cache of the calling thread's connection.
+     * @return Reference to the cache; valid as long as the connection returned by database().
+     */
+    StatementCache& statementCache();
+
+    /** @brief Returns the number of worker-thread connections currently open (the main connection excluded). */
+    int threadConnectionCount() const;
+    /**
+     * @brief Returns the schema version stored in PRAGMA user_version.
+     * @return The version of the last applied migration (0 for a baseline database).
+     */
+    int schemaVersion() const;
+
+    /**
+     * @brief Returns true if every migration was applied. The application must not run on a partly migrated
+     * schema, because the code relies on the tables and columns the later migrations add.
+     */
+    bool isSchemaCurrent() const;
+
+    /** @brief Describes the migration that failed, or returns an empty string if the schema is current. */
+    QString getSchemaError() const;
+
+    /**
+     * @brief Returns the performance profile applied to the database connections.
+     * @return The active profile.
+     */
+    const PerformanceProfile& performanceProfile() const;
 private:
+    /**
+     * @struct Migration
+     * @brief A single, ordered schema change. Versions must be strictly increasing.
+     */
+    struct Migration {
+        int version;                ///< Value written to PRAGMA user_version once applied.
+        QString description;        ///< Human readable summary used in logs.
+        QStringList statements;     ///< SQL executed in order inside one transaction.
+    };
+
     /** @brief Private constructor to enforce Singleton pattern. */
     DatabaseManager();
+    ~DatabaseManager();
+
+    /**
+     * @brief Chooses the performance profile.
+     * The BMA_DB_PROFILE environment variable takes precedence over the "profile" key of BudgetDatabase.ini;
+     * individual pragmas can be overridden in the ini file's [database] group.
+     */
+    static PerformanceProfile loadPerformanceProfile();
+
+    /**
+     * @brief Runs the per-connection PRAGMA setup (foreign keys and the performance profile).
+     * @param connection The opened connection to configure.
+     */
+    void configureConnection(QSqlDatabase& connection) const;
+
+    /**
+     * @brief Opens an additional connection to the same database file, configured like the main one.
+     * QSqlDatabase connections are bound to the thread that opens them, so this is called on the thread that will use it.
+     * @param connectionName Unique Qt connection name; pass it to closeConnection() when done.
+     * @return The connection; check isOpen() for failure.
+     */
+    QSqlDatabase openConnection(const QString& connectionName) const;
+
+    /**
+     * @brief Closes and unregisters a connection created by openConnection().
+     * Every QSqlDatabase/QSqlQuery using it must already be destroyed.
+     * @param connectionName The name passed to openConnection().
+     */
+    static void closeConnection(const QString& connectionName);
+
+    /** @brief Returns every known migration in ascending version order. */
+    static const QVector<Migration>& migrations();
+
+    /**
+     * @brief Applies all migrations newer than the stored schema version, stopping at the first failure.
+     * @return False if a migration failed; schemaError then names it.
+     */
+    bool runMigrations();
+
+    /**
+     * @brief Applies one migration atomically and bumps user_version.
+     * @param migration The migration to apply.
+     * @return True if the migration was committed.
+     */
+    bool applyMigration(const Migration& migration);
+
+    /** @brief Returns the number of rows currently violating foreign key constraints. */
+    int foreignKeyViolationCount() const;
+
+    /**
+     * @struct ThreadConnection
+     * @brief A worker thread's connection. Owned by threadConnections, which deletes it on that thread when it exits.
+     */
+    struct ThreadConnection {
+        QString name;               ///< Unique Qt connection name.
+        QSqlDatabase connection;    ///< The open connection.
+        std::unique_ptr<StatementCache> statements;    ///< Prepared statements of this connection.
+        ~ThreadConnection();
+    };
+
+    /** @brief Returns the calling worker thread's connection, opening it on first use. */
+    ThreadConnection* threadConnection();
+
     QSqlDatabase datebaseInstance;   ///< The internal Qt SQL database object.
+    std::unique_ptr<StatementCache> mainStatements;         ///< Prepared statements of datebaseInstance; created on first use.
+    PerformanceProfile profile;      ///< SQLite tuning used for every connection.
+    QThread* ownerThread;            ///< Thread that uses datebaseInstance.
+    QString schemaError;             ///< Set when a migration fails; empty while the schema is current.
+    QThreadStorage<ThreadConnection*> threadConnections;    ///< Per-thread connection pool.
+    QAtomicInteger<quint64> nextConnectionId;                ///< Suffix for unique connection names.
+    static QAtomicInt liveThreadConnections;                 ///< Worker connections currently open.
+    static QString databasePath;                             ///< File opened by the constructor.
 };
\ No newline at end of file
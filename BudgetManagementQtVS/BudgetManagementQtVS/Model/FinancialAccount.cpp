@@ -5,7 +5,7 @@
 #include "Model/FinancialAccount.h"
 
  /** @brief Constructor initializing member variables. */
-FinancialAccount::FinancialAccount(int financialAccountId, QString& financialAccountName, QString& financialAccountType, double financialAccountBalance, int profileId, double currentBalance)
+FinancialAccount::FinancialAccount(int financialAccountId, QString& financialAccountName, QString& financialAccountType, Money financialAccountBalance, int profileId, Money currentBalance)
 	: financialAccountId(financialAccountId), financialAccountName(financialAccountName), financialAccountType(financialAccountType), financialAccountBalance(financialAccountBalance), profileId(profileId), currentBalance(currentBalance)
 { }
 /** @brief Destructor. */
@@ -27,12 +27,12 @@ QString FinancialAccount::getFinancialAccountType() const
 	return financialAccountType;
 }
 
-double FinancialAccount::getFinancialAccountBalance() const 
+Money FinancialAccount::getFinancialAccountBalance() const 
 {
 	return financialAccountBalance;
 }
 
-double FinancialAccount::getFinancialAccountCurrentBalance() const
+Money FinancialAccount::getFinancialAccountCurrentBalance() const
 {
 	return currentBalance;
 }
@@ -57,11 +57,11 @@ void FinancialAccount::setFinancialAccountType(const QString& type)
 	financialAccountType = type;
 }
 
-void FinancialAccount::setFinancialAccountBalance(double balance) 
+void FinancialAccount::setFinancialAccountBalance(Money balance) 
 {
 	financialAccountBalance = balance;
 }
 
-void FinancialAccount::setFinancialAccountCurrentBalance(double balance) {
+void FinancialAccount::setFinancialAccountCurrentBalance(Money balance) {
 	currentBalance = balance;
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <QString>
+#include "Model/Money.h"
 
  /**
   * @class FinancialAccount
@@ -15,8 +16,8 @@ private:
 	int financialAccountId;			///< Unique ID of the account.
 	QString financialAccountName;	///< Name of the account.
 	QString financialAccountType;	///< Type of account (e.g., Cash, Bank).
-	double financialAccountBalance; ///< Initial/Base balance.
-	double currentBalance;			///< Calculated balance including transactions.
+	Money financialAccountBalance;  ///< Initial/Base balance.
+	Money currentBalance;			///< Calculated balance including transactions.
 	int profileId;					///< Connected profile ID.
 
 public:
@@ -27,9 +28,9 @@ public:
      * @param financialAccountType Type.
      * @param financialAccountBalance Initial balance.
      * @param profileId Profile ID.
-     * @param currentBalance Current calculated balance (default 0.0).
+     * @param currentBalance Current calculated balance (default 0).
      */
-    FinancialAccount(int financialAccountId, QString& financialAccountName, QString& financialAccountType, double financialAccountBalance, int profileId, double currentBalance = 0.0);
+    FinancialAccount(int financialAccountId, QString& financialAccountName, QString& financialAccountType, Money financialAccountBalance, int profileId, Money currentBalance = Money());
 
     ~FinancialAccount();
 
@@ -40,9 +41,9 @@ public:
     /** @brief Returns account type. */
     QString getFinancialAccountType() const;
     /** @brief Returns the base/initial balance. */
-    double getFinancialAccountBalance() const;
+    Money getFinancialAccountBalance() const;
     /** @brief Returns the current calculated balance. */
-    double getFinancialAccountCurrentBalance() const;
+    Money getFinancialAccountCurrentBalance() const;
     /** @brief Returns the ID of the connected profile. */
     int getIdOfProfileConnectedToFinancialAccount() const;
 
@@ -56,8 +57,8 @@ public:
     void setFinancialAccountType(const QString& type);
 
     /** @brief Sets Initial Balance. @param balance New balance. */
-    void setFinancialAccountBalance(double balance);
+    void setFinancialAccountBalance(Money balance);
 
     /** @brief Sets Current Balance. @param balance New current balance. */
-    void setFinancialAccountCurrentBalance(double balance);
+    void setFinancialAccountCurrentBalance(Money balance);
 };
\ No newline at end of file
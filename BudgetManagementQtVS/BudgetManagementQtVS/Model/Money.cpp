@@ -0,0 +1,61 @@
+/**
+ * @file Money.cpp
+ * @brief Implementation of the Money value type.
+ */
+#include "Model/Money.h"
+#include <limits>
+
+ /** @brief Scales to cents and rounds half away from zero. */
+Money Money::fromDouble(double value)
+{
+	return Money(qRound64(value * 100.0));
+}
+
+/** @brief Accumulates major and minor units separately; rejects more than two decimals and overflow. */
+bool Money::tryParse(QStringView text, Money& amount)
+{
+	text = text.trimmed();
+	qsizetype i = 0;
+	bool negative = false;
+	if (i < text.size() && (text[i] == QLatin1Char('-') || text[i] == QLatin1Char('+'))) {
+		negative = text[i] == QLatin1Char('-');
+		++i;
+	}
+
+	constexpr qint64 maxMajor = std::numeric_limits<qint64>::max() / 100 - 1;
+	qint64 major = 0;
+	int majorDigits = 0;
+	for (; i < text.size() && text[i].isDigit(); ++i, ++majorDigits) {
+		major = major * 10 + text[i].digitValue();
+		if (major > maxMajor) return false;
+	}
+
+	qint64 minor = 0;
+	int minorDigits = 0;
+	if (i < text.size() && text[i] == QLatin1Char('.')) {
+		for (++i; i < text.size() && text[i].isDigit(); ++i, ++minorDigits) {
+			if (minorDigits == 2) return false;
+			minor = minor * 10 + text[i].digitValue();
+		}
+		if (minorDigits == 1) minor *= 10;
+	}
+
+	if (i != text.size() || majorDigits + minorDigits == 0) return false;
+
+	const qint64 total = major * 100 + minor;
+	amount = Money(negative ? -total : total);
+	return true;
+}
+
+double Money::toDouble() const
+{
+	return static_cast<double>(cents) / 100.0;
+}
+/** @brief Integer formatting, so no floating point rounding is involved. */
+QString Money::toString() const
+{
+	const qint64 absolute = qAbs(cents);
+	QString text = QString::number(absolute / 100) + QLatin1Char('.')
+		+ QString::number(absolute % 100).rightJustified(2, QLatin1Char('0'));
+	return cents < 0 ? QStringLiteral("-") + text : text;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Money.h
+ * @brief Header file for the Money fixed-point value type.
+ */
+#pragma once
+#include <QString>
+#include <QStringView>
+#include <QtGlobal>
+
+ /**
+  * @class Money
+  * @brief Exact monetary amount stored as a 64-bit count of minor units (cents).
+  * Used everywhere inside the model and database; converted to double only at the view boundary.
+  */
+class Money
+{
+private:
+	qint64 cents;   ///< Amount in minor units.
+
+	constexpr explicit Money(qint64 minorUnits) : cents(minorUnits) {}
+public:
+    /** @brief Constructs a zero amount. */
+    constexpr Money() : cents(0) {}
+
+    /**
+     * @brief Creates an amount from minor units.
+     * @param minorUnits Amount in cents.
+     */
+    static constexpr Money fromCents(qint64 minorUnits) { return Money(minorUnits); }
+
+    /**
+     * @brief Creates an amount from a floating point value, rounding half away from zero to whole cents.
+     * @param value Amount in major units (e.g. 12.34).
+     */
+    static Money fromDouble(double value);
+
+    /**
+     * @brief Parses a decimal amount exactly, without going through floating point.
+     * Accepts an optional sign, digits and up to two decimals (e.g. "-12.05", "7", "3.5"), as written by toString().
+     * @param text Text to parse; surrounding whitespace is ignored.
+     * @param amount Receives the parsed value on success.
+     * @return True if the text is a valid amount.
+     */
+    static bool tryParse(QStringView text, Money& amount);
+
+    /** @brief Returns the amount in minor units. */
+    constexpr qint64 getCents() const { return cents; }
+
+    /** @brief Returns the amount in major units. Intended for views and charts only. */
+    double toDouble() const;
+
+    /** @brief Formats the amount with two decimals (e.g. "-12.05"). */
+    QString toString() const;
+
+    constexpr Money operator+(Money other) const { return Money(cents + other.cents); }
+    constexpr Money operator-(Money other) const { return Money(cents - other.cents); }
+    constexpr Money operator-() const { return Money(-cents); }
+    Money& operator+=(Money other) { cents += other.cents; return *this; }
+    Money& operator-=(Money other) { cents -= other.cents; return *this; }
+
+    constexpr bool operator==(Money other) const { return cents == other.cents; }
+    constexpr bool operator!=(Money other) const { return cents != other.cents; }
+    constexpr bool operator<(Money other) const { return cents < other.cents; }
+    constexpr bool operator<=(Money other) const { return cents <= other.cents; }
+    constexpr bool operator>(Money other) const { return cents > other.cents; }
+    constexpr bool operator>=(Money other) const { return cents >= other.cents; }
+};
@@ -0,0 +1,26 @@
+/**
+ * @file AsyncRepository.cpp
+ * @brief Implementation of the asynchronous repository facade.
+ */
+#include <Model/Repositories/AsyncRepository.h>
+#include <QCoreApplication>
+
+/** @brief Constructor. Parents the pool to the application so worker connections close while Qt SQL is still loaded. */
+AsyncRepository::AsyncRepository()
+    : pool(new QThreadPool(QCoreApplication::instance()))
+{
+    pool->setObjectName("DatabasePool");
+    pool->setMaxThreadCount(maxThreads);
+    pool->setExpiryTimeout(-1);
+}
+/** @brief Returns the static singleton instance. */
+AsyncRepository& AsyncRepository::instance()
+{
+    static AsyncRepository instance;
+    return instance;
+}
+
+QThreadPool* AsyncRepository::threadPool() const
+{
+    return pool;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file AsyncRepository.h
+ * @brief Header file for the asynchronous repository facade.
+ */
+#pragma once
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <utility>
+
+#include <Diagnostics/Tracer.h>
+
+#include <Model/Repositories/TransactionRepository.h>
+#include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/FinancialAccountRepository.h>
+#include <Model/Repositories/ProfileRepository.h>
+
+ /**
+  * @class AsyncRepository
+  * @brief Runs repository queries on a dedicated database thread pool and returns their results as QFuture.
+  * Each call constructs the repository on the worker, so it binds to that thread's pooled connection.
+  * Callers attach continuations with QFuture::then(context, ...), which run on the context's (UI) thread
+  * and are dropped if the context object is destroyed first.
+  *
+  * Example:
+  * @code
+  * AsyncRepository::instance().transactions([profileId](const TransactionRepository& repository) {
+  *     return repository.getAllProfileTransactionRows(profileId);
+  * }).then(this, [this](QVector<TransactionRow> rows) { ... });
+  * @endcode
+  */
+class AsyncRepository
+{
+public:
+    /**
+     * @brief Accesses the single instance of the AsyncRepository.
+     * @return Reference to the singleton instance.
+     */
+    static AsyncRepository& instance();
+
+    /**
+     * @brief Runs a query against TransactionRepository on the database pool.
+     * @param query Callable taking const TransactionRepository&; its return value becomes the future's result.
+     */
+    template <typename Query>
+    auto transactions(Query query) { return runWith<TransactionRepository>(std::move(query)); }
+
+    /** @brief Runs a query against CategoryRepository on the database pool. */
+    template <typename Query>
+    auto categories(Query query) { return runWith<CategoryRepository>(std::move(query)); }
+
+    /** @brief Runs a query against FinancialAccountRepository on the database pool. */
+    template <typename Query>
+    auto financialAccounts(Query query) { return runWith<FinancialAccountRepository>(std::move(query)); }
+
+    /** @brief Runs a query against ProfilesRepository on the database pool. */
+    template <typename Query>
+    auto profiles(Query query) { return runWith<ProfilesRepository>(std::move(query)); }
+
+    /**
+     * @brief Runs an arbitrary callable on the database pool, e.g. one combining several repositories.
+     * Repositories must be constructed inside the callable.
+     */
+    template <typename Function>
+    auto run(Function function)
+    {
+        return QtConcurrent::run(pool, [function = std::move(function)]() mutable {
+            BMA_TRACE_SCOPE("async", "AsyncRepository::run");
+            return function();
+            });
+    }
+
+    /** @brief Returns the database thread pool. */
+    QThreadPool* threadPool() const;
+
+private:
+    /** @brief Creates the pool. Its threads never expire, so their connections are reused. */
+    AsyncRepository();
+
+    template <typename Repository, typename Query>
+    auto runWith(Query query)
+    {
+        return QtConcurrent::run(pool, [query = std::move(query)]() {
+            BMA_TRACE_SCOPE("async", "AsyncRepository::query");
+            Repository repository;
+            return query(repository);
+            });
+    }
+
+    static constexpr int maxThreads = 2;    ///< SQLite serializes writers; two threads let a read overlap a slow aggregate.
+
+    QThreadPool* pool;      ///< Owned by the application object, so its threads are joined before exit.
+};
@@ -5,6 +5,23 @@
 #include <Model/Repositories/BaseRepository.h>
 
  /**
-  * @brief Constructor. Initializes the database reference from the DatabaseManager singleton.
+  * @brief Constructor. Initializes the database reference from the DatabaseManager pool for the calling thread.
   */
-BaseRepository::BaseRepository() : database(DatabaseManager::instance().database()) {}
+BaseRepository::BaseRepository()
+    : database(DatabaseManager::instance().database()),
+    statements(DatabaseManager::instance().statementCache()) {}
+
+StatementCache::Handle BaseRepository::cachedQuery(const QString& sql) const
+{
+    return statements.acquire(sql);
+}
+
+bool BaseRepository::exec(QSqlQuery& query) const
+{
+    return QueryLog::instance().exec(query, database);
+}
+
+bool BaseRepository::exec(QSqlQuery& query, const QString& sql) const
+{
+    return QueryLog::instance().exec(query, sql, database);
+}
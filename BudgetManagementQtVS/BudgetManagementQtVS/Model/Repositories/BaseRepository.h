@@ -4,16 +4,21 @@
  */
 #pragma once
 
-#include <QVector.h>
-#include <QString.h>
+#include <QVector>
+#include <QString>
 #include <QSqlQuery>
 #include <QSqlError>
 #include <QVariant>
 #include <QDebug>
 
 #include <qsqldatabase.h>
+#include <Model/Money.h>
 #include <Model/Transaction.h>
+#include <Model/TransactionRow.h>
 #include <Model/DatabaseManager.h>
+#include <Model/Repositories/StatementCache.h>
+#include <Diagnostics/Tracer.h>
+#include <Diagnostics/QueryLog.h>
 #include <Model/User.h>
 #include <Model/Profile.h>
 #include <Model/Category.h>
@@ -27,7 +32,8 @@
 class BaseRepository {
 public:
     /**
-     * @brief Constructs the BaseRepository and retrieves the database connection.
+     * @brief Constructs the BaseRepository on the calling thread's database connection.
+     * A repository must therefore be used only on the thread that created it.
      */
     BaseRepository();
 
@@ -37,5 +43,29 @@ public:
     virtual ~BaseRepository() = default;
 
 protected:
-    QSqlDatabase& database; ///< Reference to the active database connection.
+    /**
+     * @brief Returns a prepared statement for constant SQL text from the connection's statement cache.
+     * Use it like a QSqlQuery that has already been prepared: bind, exec and read results.
+     * @param sql Statement text. It may be assembled from a small fixed set of fragments, but values must be
+     * bound rather than spliced in; SQL that differs on every call should use a plain QSqlQuery instead.
+     */
+    StatementCache::Handle cachedQuery(const QString& sql) const;
+
+    /**
+     * @brief Executes a prepared statement through the slow-query log. Use instead of query.exec().
+     * @param query The prepared, bound statement.
+     * @return True if the statement executed successfully.
+     */
+    bool exec(QSqlQuery& query) const;
+
+    /**
+     * @brief Executes SQL text through the slow-query log. Use instead of query.exec(sql).
+     * @param query The query object to execute on.
+     * @param sql Statement text.
+     * @return True if the statement executed successfully.
+     */
+    bool exec(QSqlQuery& query, const QString& sql) const;
+
+    QSqlDatabase& database; ///< Connection of the thread that constructed the repository.
+    StatementCache& statements; ///< Prepared statement cache of that connection.
 };
@@ -3,25 +3,29 @@
  * @brief Implementation of the Category Repository.
  */
 #include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/DimensionCache.h>
+#include <Model/Repositories/TransactionColumnStore.h>
 
  /**
   * @brief Fetches all categories for a profile, including the default category (ID 1).
   */
 QVector<Category> CategoryRepository::getAllProfileCategories(int profileId) const
 {
+    BMA_TRACE_SCOPE("repository", "CategoryRepository::getAllProfileCategories");
     QVector<Category> categoriesForProfile;
 
-    QSqlQuery query(database);
+    StatementCache::Handle statement = cachedQuery("SELECT id, category_name, profile_id FROM category WHERE profile_id = :profile_id OR id = 1");
+    QSqlQuery& query = *statement;
 
-    query.prepare("SELECT id, category_name, profile_id FROM category WHERE profile_id = :profile_id OR id = 1");
     query.bindValue(":profile_id", profileId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "CategoryRepository::error: Couldn't get categories" << query.lastError().text();
         return categoriesForProfile;
     }
 
+    QHash<int, QString> categoryNames;
     while (query.next())
     {
         int id = query.value(0).toInt();
@@ -30,7 +34,9 @@ QVector<Category> CategoryRepository::getAllProfileCategories(int profileId) con
 
         Category category(id, categoryName, categoryProfileId);
         categoriesForProfile.append(category);
+        categoryNames.insert(id, categoryName);
     }
+    DimensionCache::instance().storeCategoryNames(categoryNames);
 
     return categoriesForProfile;
 }
@@ -39,18 +45,20 @@ QVector<Category> CategoryRepository::getAllProfileCategories(int profileId) con
  */
 bool CategoryRepository::addCategory(const QString& categoryName, int profileId) const
 {
-    QSqlQuery query(database);
+    BMA_TRACE_SCOPE("repository", "CategoryRepository::addCategory");
+    StatementCache::Handle statement = cachedQuery("INSERT INTO category (category_name, profile_id) VALUES (:name, :profile_id)");
+    QSqlQuery& query = *statement;
 
-    query.prepare("INSERT INTO category (category_name, profile_id) VALUES (:name, :profile_id)");
     query.bindValue(":name", categoryName);
     query.bindValue(":profile_id", profileId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "CategoryRepository:: error: Couldn't add category to database" << query.lastError().text();
         return false;
     }
 
+    DimensionCache::instance().storeCategoryNames({ { query.lastInsertId().toInt(), categoryName } });
     return true;
 }
 /**
@@ -59,6 +67,7 @@ bool CategoryRepository::addCategory(const QString& categoryName, int profileId)
  */
 bool CategoryRepository::removeCategoryById(int categoryId) const
 {
+    BMA_TRACE_SCOPE("repository", "CategoryRepository::removeCategoryById");
     if (categoryId == 1)
     {
         return false;
@@ -71,7 +80,7 @@ bool CategoryRepository::removeCategoryById(int categoryId) const
     query.bindValue(":defaultId", 1);
     query.bindValue(":catId", categoryId);
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "CategoryRepo::removeCategory update transactions error:" << query.lastError().text();
         database.rollback();
         return false;
@@ -80,7 +89,7 @@ bool CategoryRepository::removeCategoryById(int categoryId) const
     query.prepare("DELETE FROM category WHERE id = :id");
     query.bindValue(":id", categoryId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "CategoryRepository:: error: Couldn't remove category from database" << query.lastError().text();
         database.rollback();
@@ -93,47 +102,64 @@ bool CategoryRepository::removeCategoryById(int categoryId) const
         return false;
     }
 
+    DimensionCache::instance().removeCategory(categoryId);
+    TransactionColumnStore::instance().reassignCategory(categoryId, 1);
     return true;
 }
 /**
- * @brief Queries the category table for the name corresponding to the given ID.
+ * @brief Returns the category name from the DimensionCache. On a miss, loads the names of every
+ * category in the owning profile (plus the default category) in one query and caches them.
  */
 QString CategoryRepository::getCategoryNameById(int categoryId) const
 {
-    QSqlQuery query(database);
+    BMA_TRACE_SCOPE("repository", "CategoryRepository::getCategoryNameById");
+    DimensionCache& cache = DimensionCache::instance();
     QString categoryName = "";
+    if (cache.findCategoryName(categoryId, categoryName))
+    {
+        return categoryName;
+    }
+
+    StatementCache::Handle statement = cachedQuery("SELECT id, category_name FROM category "
+        "WHERE id = :id OR id = 1 OR profile_id = (SELECT profile_id FROM category WHERE id = :ownerId)");
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
 
-    query.prepare("SELECT category_name FROM category WHERE id = :id");
     query.bindValue(":id", categoryId);
+    query.bindValue(":ownerId", categoryId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "CategoryRepository:: error: Couldn't find category in database" << query.lastError().text();
         return categoryName;
     }
 
-    if (query.next())
+    QHash<int, QString> profileCategoryNames;
+    while (query.next())
     {
-        categoryName = query.value(0).toString();
+        profileCategoryNames.insert(query.value(0).toInt(), query.value(1).toString());
     }
+    cache.storeCategoryNames(profileCategoryNames);
 
-    return categoryName;
+    return profileCategoryNames.value(categoryId);
 }
 /**
  * @brief Updates the category_name field for the specified ID. Prevents updating the default category.
  */
 bool CategoryRepository::updateCategory(int categoryId, const QString& newName) const
 {
+    BMA_TRACE_SCOPE("repository", "CategoryRepository::updateCategory");
     if (categoryId == 1) return false;
 
-    QSqlQuery query(database);
-    query.prepare("UPDATE category SET category_name = :name WHERE id = :id");
+    StatementCache::Handle statement = cachedQuery("UPDATE category SET category_name = :name WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":name", newName);
     query.bindValue(":id", categoryId);
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "CategoryRepo::updateCategory error:" << query.lastError().text();
         return false;
     }
+    DimensionCache::instance().storeCategoryNames({ { categoryId, newName } });
     return true;
 }
@@ -0,0 +1,101 @@
+/**
+ * @file ChangeLogRepository.cpp
+ * @brief Implementation of the Change Log Repository.
+ */
+#include <Model/Repositories/ChangeLogRepository.h>
+
+ /** @brief Served by idx_change_log_user. */
+qint64 ChangeLogRepository::latestSequence(int userId) const
+{
+    BMA_TRACE_SCOPE("repository", "ChangeLogRepository::latestSequence");
+    StatementCache::Handle statement = cachedQuery("SELECT COALESCE(MAX(seq), 0) FROM change_log WHERE user_id = :userId");
+    QSqlQuery& query = *statement;
+    query.bindValue(":userId", userId);
+
+    if (!exec(query) || !query.next())
+    {
+        qDebug() << "Change log sequence lookup failed:" << query.lastError().text();
+        return -1;
+    }
+    return query.value(0).toLongLong();
+}
+/**
+ * @brief Joins each change with the transaction's current names. A change superseded by a later one
+ * for the same transaction (within the high-water mark) is skipped.
+ */
+bool ChangeLogRepository::forEachPendingChange(int userId, qint64 upToSequence, const std::function<bool(const Change&)>& visitor) const
+{
+    BMA_TRACE_SCOPE("repository", "ChangeLogRepository::forEachPendingChange");
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT cl.seq, cl.op, cl.transaction_id, cl.profile_name, "
+        "t.id, p.profile_name, t.name, t.date, t.description, t.amount, t.type, "
+        "c.category_name, fa.financialAccount_name, fa.financialAccount_type "
+        "FROM change_log cl "
+        "LEFT JOIN transactions t ON t.id = cl.transaction_id AND cl.op = 0 "
+        "LEFT JOIN profiles p ON p.id = t.profile_id "
+        "LEFT JOIN category c ON c.id = t.category_id "
+        "LEFT JOIN financialAccount fa ON fa.id = t.financialAccount_id "
+        "WHERE cl.user_id = :userId AND cl.seq <= :upTo "
+        "AND (cl.transaction_id IS NULL OR NOT EXISTS (SELECT 1 FROM change_log later "
+        "WHERE later.transaction_id = cl.transaction_id AND later.seq > cl.seq AND later.seq <= :upToLater)) "
+        "ORDER BY cl.seq"
+    );
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
+
+    query.bindValue(":userId", userId);
+    query.bindValue(":upTo", upToSequence);
+    query.bindValue(":upToLater", upToSequence);
+
+    if (!exec(query))
+    {
+        qDebug() << "Change log retrieval failed:" << query.lastError().text();
+        return false;
+    }
+
+    const QString unknown = QStringLiteral("Unknown");
+    Change change;
+    while (query.next()) {
+        change.sequence = query.value(0).toLongLong();
+        change.kind = static_cast<ChangeKind>(query.value(1).toInt());
+        change.transactionId = query.isNull(2) ? -1 : query.value(2).toInt();
+        change.deletedProfileName = query.value(3).toString();
+        change.hasRow = !query.isNull(4);
+
+        if (change.hasRow) {
+            TransactionRepository::ExportRow& row = change.row;
+            row.transactionId = query.value(4).toInt();
+            row.profileName = query.value(5).toString();
+            row.name = query.value(6).toString();
+            row.date = QDate::fromJulianDay(query.value(7).toLongLong());
+            row.description = query.value(8).toString();
+            row.amount = Money::fromCents(query.value(9).toLongLong());
+            row.type = TransactionTypes::fromStorage(query.value(10).toInt());
+            row.categoryName = query.value(11).toString();
+
+            const bool hasAccount = !query.isNull(12);
+            row.accountName = hasAccount ? query.value(12).toString() : unknown;
+            row.accountType = hasAccount ? query.value(13).toString() : unknown;
+        }
+
+        if (!visitor(change)) return false;
+    }
+
+    return true;
+}
+
+bool ChangeLogRepository::discardChanges(int userId, qint64 upToSequence) const
+{
+    BMA_TRACE_SCOPE("repository", "ChangeLogRepository::discardChanges");
+    StatementCache::Handle statement = cachedQuery("DELETE FROM change_log WHERE user_id = :userId AND seq <= :upTo");
+    QSqlQuery& query = *statement;
+    query.bindValue(":userId", userId);
+    query.bindValue(":upTo", upToSequence);
+
+    if (!exec(query))
+    {
+        qDebug() << "Change log trim failed:" << query.lastError().text();
+        return false;
+    }
+    return true;
+}
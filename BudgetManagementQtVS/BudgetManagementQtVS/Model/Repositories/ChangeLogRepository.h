@@ -0,0 +1,65 @@
+/**
+ * @file ChangeLogRepository.h
+ * @brief Header file for the Change Log Repository.
+ */
+#pragma once
+#include <Model/Repositories/BaseRepository.h>
+#include <Model/Repositories/TransactionRepository.h>
+#include <functional>
+
+ /**
+  * @class ChangeLogRepository
+  * @brief Reads and trims the trigger-maintained change_log used by the incremental autosave.
+  * Sequence numbers only grow, so the highest sequence a save has consumed acts as its high-water mark.
+  */
+class ChangeLogRepository : public BaseRepository
+{
+public:
+    /** @brief What a change_log row records. Values match the op column. */
+    enum class ChangeKind : int {
+        TransactionWritten = 0,     ///< Inserted, updated, or one of its names changed.
+        TransactionDeleted = 1,
+        ProfileDeleted = 2          ///< The profile and all of its transactions are gone.
+    };
+
+    /**
+     * @struct Change
+     * @brief One pending change, joined with the current state of the transaction it refers to.
+     */
+    struct Change
+    {
+        qint64 sequence = 0;
+        ChangeKind kind = ChangeKind::TransactionWritten;
+        int transactionId = -1;                     ///< -1 for ProfileDeleted.
+        QString deletedProfileName;                 ///< Set for ProfileDeleted only.
+        bool hasRow = false;                        ///< True if row holds the transaction's current values.
+        TransactionRepository::ExportRow row;       ///< Current values, for TransactionWritten.
+    };
+
+    ChangeLogRepository() = default;
+
+    /**
+     * @brief Returns the newest sequence number logged for a user.
+     * @param userId The ID of the user.
+     * @return The sequence, 0 if nothing is pending, or -1 on error.
+     */
+    qint64 latestSequence(int userId) const;
+
+    /**
+     * @brief Streams the pending changes of a user up to a sequence, in order.
+     * Only the last change per transaction is returned, so repeated edits produce one row.
+     * @param userId The ID of the user.
+     * @param upToSequence High-water mark; later changes are left for the next call.
+     * @param visitor Called once per change; return false to stop early.
+     * @return False if the query failed or the visitor stopped it.
+     */
+    bool forEachPendingChange(int userId, qint64 upToSequence, const std::function<bool(const Change&)>& visitor) const;
+
+    /**
+     * @brief Deletes a user's changes up to and including a sequence, once they are saved.
+     * @param userId The ID of the user.
+     * @param upToSequence High-water mark that was saved.
+     * @return True if successful.
+     */
+    bool discardChanges(int userId, qint64 upToSequence) const;
+};
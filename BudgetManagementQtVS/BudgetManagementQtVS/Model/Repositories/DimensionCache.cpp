@@ -0,0 +1,80 @@
+/**
+ * @file DimensionCache.cpp
+ * @brief Implementation of the category/account name cache.
+ */
+#include <Model/Repositories/DimensionCache.h>
+
+/** @brief Returns the static singleton instance. */
+DimensionCache& DimensionCache::instance()
+{
+    static DimensionCache instance;
+    return instance;
+}
+/** @brief Shared lookup used by both dimensions. Updates hit/miss counters. */
+bool DimensionCache::find(const QHash<int, QString>& names, int id, QString& name)
+{
+    QReadLocker locker(&lock);
+    auto it = names.constFind(id);
+    if (it == names.constEnd()) {
+        missCount.fetchAndAddRelaxed(1);
+        return false;
+    }
+    hitCount.fetchAndAddRelaxed(1);
+    name = it.value();
+    return true;
+}
+
+bool DimensionCache::findCategoryName(int categoryId, QString& categoryName)
+{
+    return find(categoryNames, categoryId, categoryName);
+}
+
+bool DimensionCache::findFinancialAccountName(int financialAccountId, QString& financialAccountName)
+{
+    return find(financialAccountNames, financialAccountId, financialAccountName);
+}
+
+void DimensionCache::storeCategoryNames(const QHash<int, QString>& names)
+{
+    QWriteLocker locker(&lock);
+    for (auto it = names.constBegin(); it != names.constEnd(); ++it) {
+        categoryNames.insert(it.key(), it.value());
+    }
+}
+
+void DimensionCache::storeFinancialAccountNames(const QHash<int, QString>& names)
+{
+    QWriteLocker locker(&lock);
+    for (auto it = names.constBegin(); it != names.constEnd(); ++it) {
+        financialAccountNames.insert(it.key(), it.value());
+    }
+}
+
+void DimensionCache::removeCategory(int categoryId)
+{
+    QWriteLocker locker(&lock);
+    categoryNames.remove(categoryId);
+}
+
+void DimensionCache::removeFinancialAccount(int financialAccountId)
+{
+    QWriteLocker locker(&lock);
+    financialAccountNames.remove(financialAccountId);
+}
+
+void DimensionCache::clear()
+{
+    QWriteLocker locker(&lock);
+    categoryNames.clear();
+    financialAccountNames.clear();
+}
+
+quint64 DimensionCache::getHitCount() const
+{
+    return hitCount.loadRelaxed();
+}
+
+quint64 DimensionCache::getMissCount() const
+{
+    return missCount.loadRelaxed();
+}
@@ -0,0 +1,70 @@
+/**
+ * @file DimensionCache.h
+ * @brief Header file for the process-wide category/account name cache.
+ */
+#pragma once
+#include <QHash>
+#include <QString>
+#include <QReadWriteLock>
+#include <QAtomicInteger>
+
+ /**
+  * @class DimensionCache
+  * @brief Singleton holding id-to-name maps for categories and financial accounts.
+  * Repositories fill it a whole profile at a time and keep it current on every write,
+  * so name lookups in filters, comparators and charts stay in memory.
+  */
+class DimensionCache {
+public:
+    /**
+     * @brief Accesses the single instance of the DimensionCache.
+     * @return Reference to the singleton instance.
+     */
+    static DimensionCache& instance();
+
+    /**
+     * @brief Looks up a cached category name.
+     * @param categoryId The ID of the category.
+     * @param categoryName Output parameter receiving the name on a hit.
+     * @return True on a cache hit, false on a miss.
+     */
+    bool findCategoryName(int categoryId, QString& categoryName);
+
+    /**
+     * @brief Looks up a cached financial account name.
+     * @param financialAccountId The ID of the account.
+     * @param financialAccountName Output parameter receiving the name on a hit.
+     * @return True on a cache hit, false on a miss.
+     */
+    bool findFinancialAccountName(int financialAccountId, QString& financialAccountName);
+
+    /** @brief Stores (or overwrites) a batch of category names. */
+    void storeCategoryNames(const QHash<int, QString>& names);
+    /** @brief Stores (or overwrites) a batch of financial account names. */
+    void storeFinancialAccountNames(const QHash<int, QString>& names);
+
+    /** @brief Removes a single category from the cache. */
+    void removeCategory(int categoryId);
+    /** @brief Removes a single financial account from the cache. */
+    void removeFinancialAccount(int financialAccountId);
+
+    /** @brief Drops every cached name. */
+    void clear();
+
+    /** @brief Returns the number of lookups answered from memory. */
+    quint64 getHitCount() const;
+    /** @brief Returns the number of lookups that had to go to the database. */
+    quint64 getMissCount() const;
+
+private:
+    /** @brief Private constructor to enforce Singleton pattern. */
+    DimensionCache() = default;
+
+    bool find(const QHash<int, QString>& names, int id, QString& name);
+
+    mutable QReadWriteLock lock;                    ///< Guards both name maps.
+    QHash<int, QString> categoryNames;              ///< Category ID -> name.
+    QHash<int, QString> financialAccountNames;      ///< Financial account ID -> name.
+    QAtomicInteger<quint64> hitCount;               ///< Lookups served from memory.
+    QAtomicInteger<quint64> missCount;              ///< Lookups that fell through to SQL.
+};
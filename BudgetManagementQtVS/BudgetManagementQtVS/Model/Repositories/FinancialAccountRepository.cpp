@@ -3,60 +3,67 @@
  * @brief Implementation of the Financial Account Repository.
  */
 #include <Model/Repositories/FinancialAccountRepository.h>
+#include <Model/Repositories/DimensionCache.h>
+#include <Model/Repositories/TransactionColumnStore.h>
 
  /**
-  * @brief Fetches accounts and dynamically calculates current balance based on transactions.
+  * @brief Fetches accounts with their stored current balance (maintained by triggers on transactions).
   */
 QVector<FinancialAccount> FinancialAccountRepository::getAllProfileFinancialAccounts(int profileId) const {
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::getAllProfileFinancialAccounts");
 	
 	QVector<FinancialAccount> financialAccountsForProfile;
 
-	QSqlQuery query(database);
+	StatementCache::Handle statement = cachedQuery("SELECT fa.id, fa.financialAccount_name, fa.financialAccount_type, fa.financialAccount_balance, fa.profile_id, fa.current_balance FROM financialAccount fa WHERE fa.profile_id = :profile_id OR fa.id = 1");
+	QSqlQuery& query = *statement;
 
-	query.prepare("SELECT fa.id, fa.financialAccount_name, fa.financialAccount_type, fa.financialAccount_balance, fa.profile_id, (fa.financialAccount_balance + COALESCE((SELECT SUM(CASE WHEN t.type = 'Income' THEN t.amount WHEN t.type = 'Expense' THEN - t.amount ELSE 0 END ) FROM transactions t WHERE t.financialAccount_id = fa.id), 0)) as current_balance FROM financialAccount fa WHERE fa.profile_id = :profile_id OR fa.id = 1");
 	query.bindValue(":profile_id", profileId);
 
-	if (!query.exec())
+	if (!exec(query))
 	{
 		qDebug() << "FinancialAccountRepository::error: Couldn't get financialAccounts" << query.lastError().text();
 		return financialAccountsForProfile;
 	}
 
+	QHash<int, QString> financialAccountNames;
 	while (query.next()) {
 		int id = query.value(0).toInt();
 		QString financialAccountName = query.value(1).toString();
 		QString financialAccountType = query.value(2).toString();
-		double financialAccountBalance = query.value(3).toDouble();
+		Money financialAccountBalance = Money::fromCents(query.value(3).toLongLong());
 		int financialAccountProfileId = query.value(4).toInt();
-		double financialAccountCurrentBalance = query.value(5).toDouble();
+		Money financialAccountCurrentBalance = Money::fromCents(query.value(5).toLongLong());
 
 		FinancialAccount financialAccount(id, financialAccountName, financialAccountType, financialAccountBalance, financialAccountProfileId, financialAccountCurrentBalance);
 		financialAccountsForProfile.append(financialAccount);
-
+		financialAccountNames.insert(id, financialAccountName);
 	}
+	DimensionCache::instance().storeFinancialAccountNames(financialAccountNames);
 
 	return financialAccountsForProfile;
 }
 /**
  * @brief Inserts a new record into the financialAccount table.
  */
-bool FinancialAccountRepository::addFinancialAccount(const QString& financialAccountName, const QString& financialAccountType, double financialAccountBalance, int profileId) const
+bool FinancialAccountRepository::addFinancialAccount(const QString& financialAccountName, const QString& financialAccountType, Money financialAccountBalance, int profileId) const
 {
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::addFinancialAccount");
 
-	QSqlQuery query(database);
+	StatementCache::Handle statement = cachedQuery("INSERT INTO financialAccount (financialAccount_name, financialAccount_type, financialAccount_balance, profile_id) VALUES (:name, :type, :balance, :profile_id)");
+	QSqlQuery& query = *statement;
 
-	query.prepare("INSERT INTO financialAccount (financialAccount_name, financialAccount_type, financialAccount_balance, profile_id) VALUES (:name, :type, :balance, :profile_id)");
 	query.bindValue(":name", financialAccountName);
 	query.bindValue(":type", financialAccountType);
-	query.bindValue(":balance", financialAccountBalance);
+	query.bindValue(":balance", financialAccountBalance.getCents());
 	query.bindValue(":profile_id", profileId);
 
-	if (!query.exec())
+	if (!exec(query))
 	{
 		qDebug() << "FinancialAccountRepository:: error: Couldn't add financialAccount to database" << query.lastError().text();
 		return false;
 	}
 
+	DimensionCache::instance().storeFinancialAccountNames({ { query.lastInsertId().toInt(), financialAccountName } });
 	return true;
 }
 /**
@@ -64,6 +71,7 @@ bool FinancialAccountRepository::addFinancialAccount(const QString& financialAcc
  */
 bool FinancialAccountRepository::removeFinancialAccount(int financialAccountId) const
 {
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::removeFinancialAccount");
 	
 	if (financialAccountId == 1) {
 		return false;
@@ -77,7 +85,7 @@ bool FinancialAccountRepository::removeFinancialAccount(int financialAccountId)
 	query.bindValue(":defaultId", 1);
 	query.bindValue(":finAccount_id", financialAccountId);
 
-	if (!query.exec()) {
+	if (!exec(query)) {
 		qDebug() << "CategoryRepo::removefinancialAccount update transactions error:" << query.lastError().text();
 		database.rollback();
 		return false;
@@ -86,7 +94,7 @@ bool FinancialAccountRepository::removeFinancialAccount(int financialAccountId)
 	query.prepare("DELETE FROM financialAccount WHERE id = :id");
 	query.bindValue(":id", financialAccountId);
 
-	if (!query.exec())
+	if (!exec(query))
 	{
 		qDebug() << "CategoryRepository:: error: Couldn't remove financialAccount from database" << query.lastError().text();
 		database.rollback();
@@ -99,49 +107,127 @@ bool FinancialAccountRepository::removeFinancialAccount(int financialAccountId)
 		return false;
 	}
 
+	DimensionCache::instance().removeFinancialAccount(financialAccountId);
+	TransactionColumnStore::instance().reassignFinancialAccount(financialAccountId, 1);
 	return true;
 }
 /**
  * @brief Updates account fields in the database. Prevents modification of the default account.
  */
-bool FinancialAccountRepository::updateFinancialAccount(int financialAccountId, const QString& newName, const QString& newType, double newBalance) const
+bool FinancialAccountRepository::updateFinancialAccount(int financialAccountId, const QString& newName, const QString& newType, Money newBalance) const
 {
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::updateFinancialAccount");
 	if (financialAccountId == 1) return false;
 
-	QSqlQuery query(database);
-	query.prepare("UPDATE financialAccount SET financialAccount_name = :name, financialAccount_type = :type, financialAccount_balance = :balance WHERE id = :id");
+	StatementCache::Handle statement = cachedQuery("UPDATE financialAccount SET financialAccount_name = :name, financialAccount_type = :type, financialAccount_balance = :balance WHERE id = :id");
+	QSqlQuery& query = *statement;
 	query.bindValue(":name", newName);
 	query.bindValue(":type", newType);
-	query.bindValue(":balance", newBalance);
+	query.bindValue(":balance", newBalance.getCents());
 	query.bindValue(":id", financialAccountId);
 
-	if (!query.exec()) {
+	if (!exec(query)) {
 		qDebug() << "FinancialAccountRepo::update error:" << query.lastError().text();
 		return false;
 	}
+	DimensionCache::instance().storeFinancialAccountNames({ { financialAccountId, newName } });
 	return true;
 }
 /**
- * @brief Selects the financialAccount_name for the given ID.
+ * @brief Returns the account name from the DimensionCache. On a miss, loads the names of every
+ * account in the owning profile (plus the default account) in one query and caches them.
  */
 QString FinancialAccountRepository::getFinancialAccountNameById(int financialAccountId) const {
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::getFinancialAccountNameById");
 
-	QSqlQuery query(database);
+	DimensionCache& cache = DimensionCache::instance();
 	QString financialAccountName = "";
+	if (cache.findFinancialAccountName(financialAccountId, financialAccountName))
+	{
+		return financialAccountName;
+	}
+
+	StatementCache::Handle statement = cachedQuery("SELECT id, financialAccount_name FROM financialAccount "
+		"WHERE id = :id OR id = 1 OR profile_id = (SELECT profile_id FROM financialAccount WHERE id = :ownerId)");
+	QSqlQuery& query = *statement;
+	query.setForwardOnly(true);
 
-	query.prepare("SELECT financialAccount_name FROM financialAccount WHERE id = :id");
 	query.bindValue(":id", financialAccountId);
+	query.bindValue(":ownerId", financialAccountId);
 
-	if (!query.exec())
+	if (!exec(query))
 	{
 		qDebug() << "FinancialAccountRepository:: error: Couldn't find valid financial account in database" << query.lastError().text();
 		return financialAccountName;
 	}
 
-	if (query.next())
+	QHash<int, QString> profileFinancialAccountNames;
+	while (query.next())
+	{
+		profileFinancialAccountNames.insert(query.value(0).toInt(), query.value(1).toString());
+	}
+	cache.storeFinancialAccountNames(profileFinancialAccountNames);
+
+	return profileFinancialAccountNames.value(financialAccountId);
+}
+/**
+ * @brief Recomputes every account balance from transactions and compares it with the stored value.
+ */
+int FinancialAccountRepository::verifyBalances(bool rebuild) const
+{
+	BMA_TRACE_SCOPE("repository", "FinancialAccountRepository::verifyBalances");
+	StatementCache::Handle statement = cachedQuery("SELECT fa.id, fa.current_balance, fa.financialAccount_balance + COALESCE((SELECT SUM(CASE WHEN t.type = :income THEN t.amount ELSE -t.amount END) "
+		"FROM transactions t WHERE t.financialAccount_id = fa.id), 0) AS expected_balance FROM financialAccount fa");
+	QSqlQuery& query = *statement;
+	query.setForwardOnly(true);
+
+	query.bindValue(":income", TransactionTypes::toStorage(TransactionType::Income));
+
+	if (!exec(query))
 	{
-		financialAccountName = query.value(0).toString();
+		qDebug() << "FinancialAccountRepository::verifyBalances error:" << query.lastError().text();
+		return -1;
+	}
+
+	QHash<int, qint64> expectedBalances;
+	while (query.next()) {
+		const int id = query.value(0).toInt();
+		const Money stored = Money::fromCents(query.value(1).toLongLong());
+		const Money expected = Money::fromCents(query.value(2).toLongLong());
+		if (stored != expected) {
+			qDebug() << "Financial account" << id << "balance drift: stored" << stored.toString() << "expected" << expected.toString()
+				<< "difference" << (stored - expected).toString();
+			expectedBalances.insert(id, expected.getCents());
+		}
 	}
+	query.finish();
 
-	return financialAccountName;
+	if (expectedBalances.isEmpty()) {
+		qDebug() << "FinancialAccountRepository::verifyBalances: all balances consistent.";
+		return 0;
+	}
+	if (!rebuild) return static_cast<int>(expectedBalances.size());
+
+	if (!database.transaction()) {
+		qDebug() << "FinancialAccountRepository::verifyBalances could not start a transaction:" << database.lastError().text();
+		return -1;
+	}
+	StatementCache::Handle updateStatement = cachedQuery("UPDATE financialAccount SET current_balance = :balance WHERE id = :id");
+	QSqlQuery& update = *updateStatement;
+	for (auto it = expectedBalances.constBegin(); it != expectedBalances.constEnd(); ++it) {
+		update.bindValue(":balance", it.value());
+		update.bindValue(":id", it.key());
+		if (!exec(update)) {
+			qDebug() << "FinancialAccountRepository::verifyBalances rebuild error:" << update.lastError().text();
+			database.rollback();
+			return -1;
+		}
+	}
+	if (!database.commit()) {
+		qDebug() << "FinancialAccountRepository::verifyBalances commit failed:" << database.lastError().text();
+		database.rollback();
+		return -1;
+	}
+	qDebug() << "FinancialAccountRepository::verifyBalances: rebuilt" << expectedBalances.size() << "account balances.";
+	return static_cast<int>(expectedBalances.size());
 }
@@ -28,7 +28,7 @@ public:
      * @param profileId The profile ID associated with the account.
      * @return True if successful, false otherwise.
      */
-    bool addFinancialAccount(const QString& financialAccountName, const QString& financialAccountType, double financialAccountBalance, int profileId) const;
+    bool addFinancialAccount(const QString& financialAccountName, const QString& financialAccountType, Money financialAccountBalance, int profileId) const;
 
     /**
      * @brief Removes a financial account by its ID.
@@ -45,7 +45,7 @@ public:
      * @param newBalance The new balance.
      * @return True if successful, false otherwise.
      */
-    bool updateFinancialAccount(int financialAccountId, const QString& newName, const QString& newType, double newBalance) const;
+    bool updateFinancialAccount(int financialAccountId, const QString& newName, const QString& newType, Money newBalance) const;
 
     /**
      * @brief Retrieves the name of a financial account by its ID.
@@ -53,4 +53,11 @@ public:
      * @return The name of the account.
      */
     QString getFinancialAccountNameById(int financialAccountId) const;
+
+    /**
+     * @brief Recomputes every stored current_balance from scratch and reports accounts that drifted.
+     * @param rebuild If true, drifted balances are overwritten with the recomputed values.
+     * @return Number of drifted accounts, or -1 on a database error.
+     */
+    int verifyBalances(bool rebuild) const;
 };
\ No newline at end of file
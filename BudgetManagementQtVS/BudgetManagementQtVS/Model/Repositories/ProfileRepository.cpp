@@ -3,19 +3,22 @@
  * @brief Implementation of the Profile Repository.
  */
 #include <Model/Repositories/ProfileRepository.h>
+#include <Model/Repositories/DimensionCache.h>
+#include <Model/Repositories/TransactionColumnStore.h>
 
  /**
   * @brief Queries the profiles table for all records matching the user ID.
   */
 QVector<Profile> ProfilesRepository::getProfilesByUserId(int userId) const
 {
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::getProfilesByUserId");
     QVector<Profile> foundProfiles;
 
-    QSqlQuery query(database);
-    query.prepare("SELECT id, profile_name, user_id FROM profiles WHERE user_id = :userId");
+    StatementCache::Handle statement = cachedQuery("SELECT id, profile_name, user_id FROM profiles WHERE user_id = :userId");
+    QSqlQuery& query = *statement;
     query.bindValue(":userId", userId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "ProfilesRepo::getting profiles that belong to user error:" << query.lastError().text();
         return foundProfiles;
@@ -38,12 +41,13 @@ QVector<Profile> ProfilesRepository::getProfilesByUserId(int userId) const
  */
 bool ProfilesRepository::addProfile(int userId, QString profileName) const
 {
-    QSqlQuery query(database);
-    query.prepare("INSERT INTO profiles (profile_name, user_id) VALUES (:profileName, :userId)");
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::addProfile");
+    StatementCache::Handle statement = cachedQuery("INSERT INTO profiles (profile_name, user_id) VALUES (:profileName, :userId)");
+    QSqlQuery& query = *statement;
     query.bindValue(":profileName", profileName);
     query.bindValue(":userId", userId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "ProfilesRepo::adding profile to database error:" << query.lastError().text();
         return false;
@@ -56,15 +60,19 @@ bool ProfilesRepository::addProfile(int userId, QString profileName) const
  */
 bool ProfilesRepository::removeProfileById(int profileId) const
 {
-    QSqlQuery query(database);
-    query.prepare("DELETE FROM profiles WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::removeProfileById");
+    StatementCache::Handle statement = cachedQuery("DELETE FROM profiles WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":id", profileId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "ProfilesRepo::removing profile to database error:" << query.lastError().text();
         return false;
     }
+    // The delete cascades to the profile's categories and accounts; their names are reloaded on demand.
+    DimensionCache::instance().clear();
+    TransactionColumnStore::instance().dropProfile(profileId);
     return true;
 }
 /**
@@ -72,12 +80,13 @@ bool ProfilesRepository::removeProfileById(int profileId) const
  */
 bool ProfilesRepository::updateProfile(int profileId, const QString& newName) const
 {
-    QSqlQuery query(database);
-    query.prepare("UPDATE profiles SET profile_name = :name WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::updateProfile");
+    StatementCache::Handle statement = cachedQuery("UPDATE profiles SET profile_name = :name WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":name", newName);
     query.bindValue(":id", profileId);
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "ProfilesRepo::updateProfile error:" << query.lastError().text();
         return false;
     }
@@ -86,24 +95,26 @@ bool ProfilesRepository::updateProfile(int profileId, const QString& newName) co
 /**
  * @brief Selects the budget_limit value for the profile.
  */
-double ProfilesRepository::getBudgetLimit(int profileId) const
+Money ProfilesRepository::getBudgetLimit(int profileId) const
 {
-    QSqlQuery query(database);
-    query.prepare("SELECT budget_limit FROM profiles WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::getBudgetLimit");
+    StatementCache::Handle statement = cachedQuery("SELECT budget_limit FROM profiles WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":id", profileId);
-    if (query.exec() && query.next()) {
-        return query.value(0).toDouble();
+    if (exec(query) && query.next()) {
+        return Money::fromCents(query.value(0).toLongLong());
     }
-    return 0.0;
+    return Money();
 }
 /**
  * @brief Updates the 'budget_limit' column in the 'profiles' table.
  */
-bool ProfilesRepository::setBudgetLimit(int profileId, double limit) const
+bool ProfilesRepository::setBudgetLimit(int profileId, Money limit) const
 {
-    QSqlQuery query(database);
-    query.prepare("UPDATE profiles SET budget_limit = :limit WHERE id = :id");
-    query.bindValue(":limit", limit);
+    BMA_TRACE_SCOPE("repository", "ProfilesRepository::setBudgetLimit");
+    StatementCache::Handle statement = cachedQuery("UPDATE profiles SET budget_limit = :limit WHERE id = :id");
+    QSqlQuery& query = *statement;
+    query.bindValue(":limit", limit.getCents());
     query.bindValue(":id", profileId);
-    return query.exec();
+    return exec(query);
 }
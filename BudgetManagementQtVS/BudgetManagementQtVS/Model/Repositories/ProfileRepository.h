@@ -48,7 +48,7 @@ public:
      * @param profileId The ID of the profile.
      * @return The budget limit amount.
      */
-    double getBudgetLimit(int profileId) const;
+    Money getBudgetLimit(int profileId) const;
 
     /**
      * @brief Sets the monthly budget limit for a profile.
@@ -56,5 +56,5 @@ public:
      * @param limit The new budget limit.
      * @return True if successful, false otherwise.
      */
-    bool setBudgetLimit(int profileId, double limit) const;
+    bool setBudgetLimit(int profileId, Money limit) const;
 };
@@ -0,0 +1,109 @@
+/**
+ * @file StatementCache.cpp
+ * @brief Implementation of the per-connection prepared statement cache.
+ */
+#include <Model/Repositories/StatementCache.h>
+#include <Diagnostics/Tracer.h>
+#include <QElapsedTimer>
+#include <QSqlError>
+#include <QDebug>
+#include <utility>
+
+QAtomicInteger<quint64> StatementCache::hitCount(0);
+QAtomicInteger<quint64> StatementCache::missCount(0);
+QAtomicInteger<quint64> StatementCache::evictionCount(0);
+QAtomicInteger<quint64> StatementCache::prepareNanoseconds(0);
+
+StatementCache::Handle::Handle(StatementCache* owner, const QString& sql, QSqlQuery&& query)
+    : owner(owner), sql(sql), query(std::move(query))
+{
+}
+
+StatementCache::Handle::Handle(Handle&& other) noexcept
+    : owner(std::exchange(other.owner, nullptr)), sql(std::move(other.sql)), query(std::move(other.query))
+{
+}
+/** @brief Resets the statement so it holds no read lock, then hands it back. */
+StatementCache::Handle::~Handle()
+{
+    if (!owner) return;
+    query.finish();
+    owner->release(std::move(sql), std::move(query));
+}
+
+StatementCache::StatementCache(const QSqlDatabase& connection, int capacity)
+    : connection(connection), capacity(capacity)
+{
+}
+
+StatementCache::~StatementCache()
+{
+    clear();
+}
+/** @brief Moves a cached statement out of the LRU list, or prepares a new one on a miss. */
+StatementCache::Handle StatementCache::acquire(const QString& sql)
+{
+    auto found = entryBySql.find(sql);
+    if (found != entryBySql.end()) {
+        hitCount.fetchAndAddRelaxed(1);
+        QSqlQuery query = std::move(found.value()->query);
+        entries.erase(found.value());
+        entryBySql.erase(found);
+        return Handle(this, sql, std::move(query));
+    }
+
+    missCount.fetchAndAddRelaxed(1);
+    QElapsedTimer timer;
+    timer.start();
+
+    BMA_TRACE_SCOPE("sql", "StatementCache::prepare");
+    QSqlQuery query(connection);
+    const bool prepared = query.prepare(sql);
+    prepareNanoseconds.fetchAndAddRelaxed(timer.nsecsElapsed());
+
+    if (!prepared) {
+        qDebug() << "StatementCache::error: Couldn't prepare statement" << query.lastError().text() << sql;
+        return Handle(nullptr, sql, std::move(query));
+    }
+    return Handle(this, sql, std::move(query));
+}
+/** @brief Keeps at most one idle copy per SQL text; a duplicate released by nested use is dropped. */
+void StatementCache::release(QString&& sql, QSqlQuery&& query)
+{
+    if (entryBySql.contains(sql)) return;
+
+    entries.push_front(Entry{ sql, std::move(query) });
+    entryBySql.insert(std::move(sql), entries.begin());
+
+    while (entries.size() > static_cast<size_t>(capacity)) {
+        entryBySql.remove(entries.back().sql);
+        entries.pop_back();
+        evictionCount.fetchAndAddRelaxed(1);
+    }
+}
+
+void StatementCache::clear()
+{
+    entryBySql.clear();
+    entries.clear();
+}
+
+quint64 StatementCache::getHitCount()
+{
+    return hitCount.loadRelaxed();
+}
+
+quint64 StatementCache::getMissCount()
+{
+    return missCount.loadRelaxed();
+}
+
+quint64 StatementCache::getEvictionCount()
+{
+    return evictionCount.loadRelaxed();
+}
+
+quint64 StatementCache::getPrepareNanoseconds()
+{
+    return prepareNanoseconds.loadRelaxed();
+}
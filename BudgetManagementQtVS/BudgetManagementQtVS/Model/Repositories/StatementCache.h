@@ -0,0 +1,107 @@
+/**
+ * @file StatementCache.h
+ * @brief Header file for the per-connection prepared statement cache.
+ */
+#pragma once
+#include <QHash>
+#include <QString>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QAtomicInteger>
+#include <list>
+
+ /**
+  * @class StatementCache
+  * @brief Keeps prepared QSqlQuery objects of one connection, keyed by SQL text, so identical statements
+  * are parsed and planned by SQLite once per connection instead of once per call.
+  * The least recently used statement is finalized when the cache is full.
+  * A cache belongs to one connection and, like it, must only be used on that connection's thread.
+  */
+class StatementCache
+{
+public:
+    /**
+     * @class Handle
+     * @brief A checked-out prepared statement. Returned to the cache, finished, when the handle is destroyed.
+     * While checked out the statement is not in the cache, so nested use of the same SQL prepares a second copy.
+     */
+    class Handle
+    {
+    public:
+        Handle(Handle&& other) noexcept;
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        Handle& operator=(Handle&&) = delete;
+        ~Handle();
+
+        QSqlQuery& operator*() { return query; }
+        QSqlQuery* operator->() { return &query; }
+
+    private:
+        friend class StatementCache;
+        Handle(StatementCache* owner, const QString& sql, QSqlQuery&& query);
+
+        StatementCache* owner;  ///< Null if the statement failed to prepare and must not be cached.
+        QString sql;
+        QSqlQuery query;
+    };
+
+    /**
+     * @brief Constructs an empty cache for one connection.
+     * @param connection The connection statements are prepared on.
+     * @param capacity Maximum number of idle statements kept.
+     */
+    explicit StatementCache(const QSqlDatabase& connection, int capacity = defaultCapacity);
+
+    /** @brief Finalizes every cached statement. Must run before the connection is closed. */
+    ~StatementCache();
+
+    StatementCache(const StatementCache&) = delete;
+    StatementCache& operator=(const StatementCache&) = delete;
+
+    /**
+     * @brief Returns a prepared statement for the SQL text, preparing it only on a cache miss.
+     * Bound values from the previous use are overwritten by the caller's bindValue() calls.
+     * @param sql Statement text; must not vary per call (bind values instead).
+     * @return Handle giving access to the statement.
+     */
+    Handle acquire(const QString& sql);
+
+    /** @brief Finalizes every idle statement. */
+    void clear();
+
+    /** @brief Returns the number of statements served without preparing, across all connections. */
+    static quint64 getHitCount();
+    /** @brief Returns the number of statements that had to be prepared, across all connections. */
+    static quint64 getMissCount();
+    /** @brief Returns the number of statements finalized to make room, across all connections. */
+    static quint64 getEvictionCount();
+    /** @brief Returns the total time spent in prepare() on misses, in nanoseconds, across all connections. */
+    static quint64 getPrepareNanoseconds();
+
+private:
+    static constexpr int defaultCapacity = 64;
+
+    /**
+     * @struct Entry
+     * @brief An idle prepared statement.
+     */
+    struct Entry
+    {
+        QString sql;
+        QSqlQuery query;
+    };
+
+    /** @brief Puts a statement back as the most recently used one, evicting from the tail if full. */
+    void release(QString&& sql, QSqlQuery&& query);
+
+    QSqlDatabase connection;
+    int capacity;
+    std::list<Entry> entries;                                   ///< Most recently used first.
+    QHash<QString, std::list<Entry>::iterator> entryBySql;      ///< SQL text -> position in entries.
+
+    static QAtomicInteger<quint64> hitCount;
+    static QAtomicInteger<quint64> missCount;
+    static QAtomicInteger<quint64> evictionCount;
+    static QAtomicInteger<quint64> prepareNanoseconds;
+};
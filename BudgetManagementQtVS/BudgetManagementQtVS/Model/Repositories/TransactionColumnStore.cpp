@@ -0,0 +1,304 @@
+/**
+ * @file TransactionColumnStore.cpp
+ * @brief Implementation of the in-memory columnar transaction store.
+ */
+#include <Model/Repositories/TransactionColumnStore.h>
+#include <Diagnostics/Tracer.h>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+QStringView TransactionColumnStore::ProfileColumns::name(qsizetype row) const
+{
+    const TextSpan span = names.at(row);
+    return QStringView(textArena).mid(span.offset, span.length);
+}
+
+QStringView TransactionColumnStore::ProfileColumns::description(qsizetype row) const
+{
+    const TextSpan span = descriptions.at(row);
+    return QStringView(textArena).mid(span.offset, span.length);
+}
+
+void TransactionColumnStore::ProfileColumns::append(const Transaction& transaction)
+{
+    rowById.insert(transaction.getTransactionId(), ids.size());
+    ids.append(transaction.getTransactionId());
+    days.append(static_cast<qint32>(transaction.getTransactionDate().toJulianDay()));
+    amountCents.append(transaction.getTransactionAmount().getCents());
+    types.append(static_cast<quint8>(TransactionTypes::toStorage(transaction.getTransactionType())));
+    categoryIds.append(transaction.getCategoryId());
+    financialAccountIds.append(transaction.getFinancialAccountId());
+    names.append(storeText(transaction.getTransactionName()));
+    descriptions.append(storeText(transaction.getTransactionDescription()));
+}
+/** @brief The replaced strings stay in the arena as dead text until the next compaction. */
+void TransactionColumnStore::ProfileColumns::assign(qsizetype row, const Transaction& transaction)
+{
+    days[row] = static_cast<qint32>(transaction.getTransactionDate().toJulianDay());
+    amountCents[row] = transaction.getTransactionAmount().getCents();
+    types[row] = static_cast<quint8>(TransactionTypes::toStorage(transaction.getTransactionType()));
+    categoryIds[row] = transaction.getCategoryId();
+    financialAccountIds[row] = transaction.getFinancialAccountId();
+
+    deadTextLength += names.at(row).length + descriptions.at(row).length;
+    names[row] = storeText(transaction.getTransactionName());
+    descriptions[row] = storeText(transaction.getTransactionDescription());
+    compactTextIfWasteful();
+}
+
+void TransactionColumnStore::ProfileColumns::removeAt(qsizetype row)
+{
+    const qsizetype last = ids.size() - 1;
+    deadTextLength += names.at(row).length + descriptions.at(row).length;
+    rowById.remove(ids.at(row));
+
+    if (row != last) {
+        ids[row] = ids.at(last);
+        days[row] = days.at(last);
+        amountCents[row] = amountCents.at(last);
+        types[row] = types.at(last);
+        categoryIds[row] = categoryIds.at(last);
+        financialAccountIds[row] = financialAccountIds.at(last);
+        names[row] = names.at(last);
+        descriptions[row] = descriptions.at(last);
+        rowById.insert(ids.at(row), row);
+    }
+
+    ids.removeLast();
+    days.removeLast();
+    amountCents.removeLast();
+    types.removeLast();
+    categoryIds.removeLast();
+    financialAccountIds.removeLast();
+    names.removeLast();
+    descriptions.removeLast();
+    compactTextIfWasteful();
+}
+
+TransactionColumnStore::TextSpan TransactionColumnStore::ProfileColumns::storeText(const QString& text)
+{
+    const TextSpan span{ static_cast<qint32>(textArena.size()), static_cast<qint32>(text.size()) };
+    textArena.append(text);
+    return span;
+}
+
+void TransactionColumnStore::ProfileColumns::compactTextIfWasteful()
+{
+    if (deadTextLength * 2 <= textArena.size()) return;
+
+    QString compacted;
+    compacted.reserve(textArena.size() - deadTextLength);
+    const auto relocate = [this, &compacted](TextSpan& span) {
+        const qint32 offset = static_cast<qint32>(compacted.size());
+        compacted.append(QStringView(textArena).mid(span.offset, span.length));
+        span.offset = offset;
+    };
+    for (qsizetype row = 0; row < ids.size(); ++row) {
+        relocate(names[row]);
+        relocate(descriptions[row]);
+    }
+    textArena = std::move(compacted);
+    deadTextLength = 0;
+}
+
+/** @brief Returns the static singleton instance. */
+TransactionColumnStore& TransactionColumnStore::instance()
+{
+    static TransactionColumnStore instance;
+    return instance;
+}
+
+quint64 TransactionColumnStore::getVersion() const
+{
+    return version.loadAcquire();
+}
+
+bool TransactionColumnStore::isLoaded(int profileId) const
+{
+    QReadLocker locker(&lock);
+    return profiles.contains(profileId);
+}
+/** @brief Writers bump the version under the write lock, so the check and the install cannot interleave with a write. */
+bool TransactionColumnStore::storeProfile(int profileId, ProfileColumns&& columns, quint64 loadedAtVersion)
+{
+    QWriteLocker locker(&lock);
+    if (version.loadRelaxed() != loadedAtVersion) return false;
+    if (!profiles.contains(profileId)) {
+        profiles.emplace(profileId, std::move(columns));
+    }
+    return true;
+}
+/**
+ * @brief Inserts or, if the row is already there, overwrites it. A load that ran after the commit but
+ * before this call has already read the row, so adding it again would duplicate it.
+ */
+void TransactionColumnStore::addTransaction(const Transaction& transaction)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    auto found = profiles.find(transaction.getAssociatedProfileId());
+    if (found == profiles.end()) return;
+
+    ProfileColumns& columns = found.value();
+    auto existing = columns.rowById.constFind(transaction.getTransactionId());
+    if (existing != columns.rowById.constEnd()) {
+        columns.assign(existing.value(), transaction);
+    }
+    else {
+        columns.append(transaction);
+    }
+}
+
+void TransactionColumnStore::updateTransaction(const Transaction& transaction)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    qsizetype row = -1;
+    if (ProfileColumns* columns = findOwner(transaction.getTransactionId(), row)) {
+        columns->assign(row, transaction);
+    }
+}
+
+void TransactionColumnStore::removeTransaction(int transactionId)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    qsizetype row = -1;
+    if (ProfileColumns* columns = findOwner(transactionId, row)) {
+        columns->removeAt(row);
+    }
+}
+
+void TransactionColumnStore::reassignCategory(int fromCategoryId, int toCategoryId)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    for (ProfileColumns& columns : profiles) {
+        std::replace(columns.categoryIds.begin(), columns.categoryIds.end(), fromCategoryId, toCategoryId);
+    }
+}
+
+void TransactionColumnStore::reassignFinancialAccount(int fromFinancialAccountId, int toFinancialAccountId)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    for (ProfileColumns& columns : profiles) {
+        std::replace(columns.financialAccountIds.begin(), columns.financialAccountIds.end(), fromFinancialAccountId, toFinancialAccountId);
+    }
+}
+
+void TransactionColumnStore::dropProfile(int profileId)
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    profiles.remove(profileId);
+}
+
+void TransactionColumnStore::clear()
+{
+    QWriteLocker locker(&lock);
+    version.fetchAndAddRelease(1);
+    profiles.clear();
+}
+
+TransactionColumnStore::ProfileColumns* TransactionColumnStore::findOwner(int transactionId, qsizetype& row)
+{
+    for (ProfileColumns& columns : profiles) {
+        auto found = columns.rowById.constFind(transactionId);
+        if (found != columns.rowById.constEnd()) {
+            row = found.value();
+            return &columns;
+        }
+    }
+    return nullptr;
+}
+/** @brief Touches only the days, types and amounts columns. */
+bool TransactionColumnStore::sumByTypeAndDate(int profileId, TransactionType type, const QDate& start, const QDate& end, Money& total) const
+{
+    BMA_TRACE_SCOPE("store", "TransactionColumnStore::sumByTypeAndDate");
+    const qint32 startDay = static_cast<qint32>(start.toJulianDay());
+    const qint32 endDay = static_cast<qint32>(end.toJulianDay());
+    const quint8 wantedType = static_cast<quint8>(TransactionTypes::toStorage(type));
+
+    return scan(profileId, [&](const ProfileColumns& columns) {
+        const qint32* days = columns.days.constData();
+        const quint8* types = columns.types.constData();
+        const qint64* amounts = columns.amountCents.constData();
+        qint64 cents = 0;
+        for (qsizetype row = 0, rows = columns.size(); row < rows; ++row) {
+            if (types[row] == wantedType && days[row] >= startDay && days[row] <= endDay) {
+                cents += amounts[row];
+            }
+        }
+        total = Money::fromCents(cents);
+        });
+}
+/**
+ * @brief One pass sums the period and finds the span of expense days; a second marks the months that have
+ * expenses through a day-to-month table, so no row is converted to a QDate.
+ */
+bool TransactionColumnStore::summarize(int profileId, const QDate& start, const QDate& end, Summary& summary) const
+{
+    BMA_TRACE_SCOPE("store", "TransactionColumnStore::summarize");
+    const qint32 startDay = static_cast<qint32>(start.toJulianDay());
+    const qint32 endDay = static_cast<qint32>(end.toJulianDay());
+    const quint8 income = static_cast<quint8>(TransactionTypes::toStorage(TransactionType::Income));
+
+    return scan(profileId, [&](const ProfileColumns& columns) {
+        const qsizetype rows = columns.size();
+        const qint32* days = columns.days.constData();
+        const quint8* types = columns.types.constData();
+        const qint64* amounts = columns.amountCents.constData();
+        const int* categories = columns.categoryIds.constData();
+
+        qint64 incomeCents = 0;
+        qint64 expenseCents = 0;
+        qint64 allTimeExpenseCents = 0;
+        qint32 firstExpenseDay = std::numeric_limits<qint32>::max();
+        qint32 lastExpenseDay = std::numeric_limits<qint32>::min();
+        QHash<int, qint64> categoryCents;
+
+        for (qsizetype row = 0; row < rows; ++row) {
+            const bool inPeriod = days[row] >= startDay && days[row] <= endDay;
+            if (types[row] == income) {
+                if (inPeriod) incomeCents += amounts[row];
+                continue;
+            }
+            allTimeExpenseCents += amounts[row];
+            firstExpenseDay = std::min(firstExpenseDay, days[row]);
+            lastExpenseDay = std::max(lastExpenseDay, days[row]);
+            if (inPeriod) {
+                expenseCents += amounts[row];
+                categoryCents[categories[row]] += amounts[row];
+            }
+        }
+
+        int monthsWithExpenses = 0;
+        if (firstExpenseDay <= lastExpenseDay) {
+            const QDate firstMonth = QDate::fromJulianDay(firstExpenseDay);
+            std::vector<int> monthOfDay(static_cast<size_t>(lastExpenseDay - firstExpenseDay) + 1);
+            for (qint32 day = firstExpenseDay; day <= lastExpenseDay; ++day) {
+                const QDate date = QDate::fromJulianDay(day);
+                monthOfDay[day - firstExpenseDay] = (date.year() - firstMonth.year()) * 12 + date.month() - firstMonth.month();
+            }
+            std::vector<bool> monthHasExpenses(static_cast<size_t>(monthOfDay.back()) + 1, false);
+            for (qsizetype row = 0; row < rows; ++row) {
+                if (types[row] != income) {
+                    monthHasExpenses[monthOfDay[days[row] - firstExpenseDay]] = true;
+                }
+            }
+            monthsWithExpenses = static_cast<int>(std::count(monthHasExpenses.begin(), monthHasExpenses.end(), true));
+        }
+
+        summary.income = Money::fromCents(incomeCents);
+        summary.expense = Money::fromCents(expenseCents);
+        summary.monthlyAverageExpense = Money::fromCents(qRound64(static_cast<double>(allTimeExpenseCents) / std::max(monthsWithExpenses, 1)));
+        summary.expensesByCategory.clear();
+        for (auto it = categoryCents.constBegin(); it != categoryCents.constEnd(); ++it) {
+            summary.expensesByCategory.insert(it.key(), Money::fromCents(it.value()));
+        }
+        });
+}
@@ -0,0 +1,166 @@
+/**
+ * @file TransactionColumnStore.h
+ * @brief Header file for the in-memory columnar transaction store.
+ */
+#pragma once
+#include <QDate>
+#include <QHash>
+#include <QMap>
+#include <QReadWriteLock>
+#include <QString>
+#include <QStringView>
+#include <QVector>
+#include <QAtomicInteger>
+#include <Model/Money.h>
+#include <Model/Transaction.h>
+
+ /**
+  * @class TransactionColumnStore
+  * @brief Singleton holding each loaded profile's transactions as parallel arrays (structure of arrays),
+  * so that aggregations scan a few contiguous columns instead of whole Transaction objects.
+  *
+  * TransactionRepository loads a profile once and keeps the store current on every write, like the
+  * DimensionCache. A load is discarded if any transaction was written while it ran, because the rows it
+  * read might predate that write; the next load starts over. AppController evicts the profile being left when
+  * the user switches profile or logs out, so normally only the active profile is resident.
+  */
+class TransactionColumnStore {
+public:
+    /**
+     * @struct TextSpan
+     * @brief Location of one string in a profile's text arena.
+     */
+    struct TextSpan
+    {
+        qint32 offset = 0;
+        qint32 length = 0;
+    };
+
+    /**
+     * @struct ProfileColumns
+     * @brief One profile's transactions; row i of every column belongs to the same transaction.
+     * Rows are unordered: removing a row moves the last row into its place.
+     */
+    struct ProfileColumns
+    {
+        QVector<int> ids;
+        QVector<qint32> days;               ///< Julian day numbers.
+        QVector<qint64> amountCents;
+        QVector<quint8> types;              ///< TransactionTypes::toStorage values.
+        QVector<int> categoryIds;
+        QVector<int> financialAccountIds;
+        QVector<TextSpan> names;            ///< Spans in textArena.
+        QVector<TextSpan> descriptions;     ///< Spans in textArena.
+        QString textArena;                  ///< Every name and description of the profile, back to back.
+        qsizetype deadTextLength = 0;       ///< Characters in textArena no longer referenced by any span.
+        QHash<int, qsizetype> rowById;      ///< Transaction ID -> row.
+
+        /** @brief Returns the number of rows. */
+        qsizetype size() const { return ids.size(); }
+
+        /** @brief Returns the name of a row as a view into the arena. */
+        QStringView name(qsizetype row) const;
+        /** @brief Returns the description of a row as a view into the arena. */
+        QStringView description(qsizetype row) const;
+
+        /** @brief Appends a transaction as a new row. */
+        void append(const Transaction& transaction);
+        /** @brief Overwrites every column of an existing row. */
+        void assign(qsizetype row, const Transaction& transaction);
+        /** @brief Removes a row by moving the last row into its place. */
+        void removeAt(qsizetype row);
+
+    private:
+        /** @brief Copies text to the end of the arena. */
+        TextSpan storeText(const QString& text);
+        /** @brief Rewrites the arena without unreferenced text once more than half of it is dead. */
+        void compactTextIfWasteful();
+    };
+
+    /**
+     * @struct Summary
+     * @brief Every figure of the charts page, computed from a profile's columns in one call.
+     */
+    struct Summary
+    {
+        Money income;                           ///< Income in the period.
+        Money expense;                          ///< Expenses in the period.
+        Money monthlyAverageExpense;            ///< All-time expenses divided by the number of months that have any.
+        QMap<int, Money> expensesByCategory;    ///< Category ID -> expenses in the period.
+    };
+
+    /**
+     * @brief Accesses the single instance of the TransactionColumnStore.
+     * @return Reference to the singleton instance.
+     */
+    static TransactionColumnStore& instance();
+
+    /** @brief Returns a counter incremented by every write; pass it back to storeProfile(). */
+    quint64 getVersion() const;
+
+    /** @brief Returns true if the profile's columns are loaded. */
+    bool isLoaded(int profileId) const;
+
+    /**
+     * @brief Installs a freshly loaded profile.
+     * @param profileId The profile the columns belong to.
+     * @param columns Every transaction of the profile.
+     * @param loadedAtVersion getVersion() read before the load started.
+     * @return False if a transaction was written since, in which case the columns are discarded.
+     */
+    bool storeProfile(int profileId, ProfileColumns&& columns, quint64 loadedAtVersion);
+
+    /** @brief Adds or overwrites a committed transaction (its ID must be set), if its profile is loaded. */
+    void addTransaction(const Transaction& transaction);
+    /** @brief Replaces a committed transaction's row, if its profile is loaded. */
+    void updateTransaction(const Transaction& transaction);
+    /** @brief Removes a deleted transaction from whichever loaded profile holds it. */
+    void removeTransaction(int transactionId);
+    /** @brief Mirrors transactions being moved to another category when one is deleted. */
+    void reassignCategory(int fromCategoryId, int toCategoryId);
+    /** @brief Mirrors transactions being moved to another account when one is deleted. */
+    void reassignFinancialAccount(int fromFinancialAccountId, int toFinancialAccountId);
+    /** @brief Forgets a profile, e.g. after it was deleted with its transactions. */
+    void dropProfile(int profileId);
+    /** @brief Forgets every profile. */
+    void clear();
+
+    /**
+     * @brief Gives read access to a loaded profile's columns while holding the read lock.
+     * @param profileId The profile to scan.
+     * @param visitor Called once with the const ProfileColumns&; must not call back into the store.
+     * @return False if the profile is not loaded (the visitor is not called).
+     */
+    template<typename Visitor>
+    bool scan(int profileId, Visitor&& visitor) const
+    {
+        QReadLocker locker(&lock);
+        auto found = profiles.constFind(profileId);
+        if (found == profiles.constEnd()) return false;
+        visitor(found.value());
+        return true;
+    }
+
+    /**
+     * @brief Sums the amounts of one type in an inclusive date range.
+     * @return False if the profile is not loaded.
+     */
+    bool sumByTypeAndDate(int profileId, TransactionType type, const QDate& start, const QDate& end, Money& total) const;
+
+    /**
+     * @brief Computes the charts figures for an inclusive date range.
+     * @return False if the profile is not loaded.
+     */
+    bool summarize(int profileId, const QDate& start, const QDate& end, Summary& summary) const;
+
+private:
+    /** @brief Private constructor to enforce Singleton pattern. */
+    TransactionColumnStore() = default;
+
+    /** @brief Finds the loaded profile holding a transaction. Call with the lock held. */
+    ProfileColumns* findOwner(int transactionId, qsizetype& row);
+
+    mutable QReadWriteLock lock;                    ///< Guards profiles.
+    QHash<int, ProfileColumns> profiles;            ///< Profile ID -> columns.
+    QAtomicInteger<quint64> version;                ///< Incremented on every write, loaded or not.
+};
@@ -3,22 +3,25 @@
  * @brief Implementation of the Transaction Repository.
  */
 #include <Model/Repositories/TransactionRepository.h>
+#include <QRegularExpression>
+#include <algorithm>
 
  /**
   * @brief Retrieves transactions filtered by profile_id.
   */
 QVector<Transaction> TransactionRepository::getAllProfileTransaction(int profileId) const
 {
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getAllProfileTransaction");
     QVector<Transaction> result;
-    QSqlQuery query(database);
-
-    query.prepare(
+    StatementCache::Handle statement = cachedQuery(
         "SELECT id, name, date, description, amount, type, category_id, financialAccount_id, profile_id "
         "FROM transactions WHERE profile_id = :profileId"
     );
+    QSqlQuery& query = *statement;
+
     query.bindValue(":profileId", profileId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "Transaction retrieval for profile failed:" << query.lastError().text();
         return result;
@@ -27,32 +30,322 @@ QVector<Transaction> TransactionRepository::getAllProfileTransaction(int profile
     while (query.next()) {
         int id = query.value(0).toInt();
         QString name = query.value(1).toString();
-        QString dateStr = query.value(2).toString();
+        QDate date = QDate::fromJulianDay(query.value(2).toLongLong());
         QString description = query.value(3).toString();
-        double amount = query.value(4).toDouble();
-        QString type = query.value(5).toString();
+        Money amount = Money::fromCents(query.value(4).toLongLong());
+        TransactionType type = TransactionTypes::fromStorage(query.value(5).toInt());
         int categoryId = query.value(6).toInt();
         int financialAccountId = query.value(7).toInt();
         int profileId = query.value(8).toInt();
 
-        QDate date = QDate::fromString(dateStr, "yyyy-MM-dd");
-
         Transaction transaction(id, name, date, description, amount, type, categoryId, financialAccountId, profileId);
         result.append(transaction);
     }
 
     return result;
 }
+/**
+ * @brief Retrieves profile transactions with category and account names resolved via LEFT JOIN.
+ */
+QVector<TransactionRow> TransactionRepository::getAllProfileTransactionRows(int profileId) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getAllProfileTransactionRows");
+    QVector<TransactionRow> result;
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT t.id, t.name, t.date, t.description, t.amount, t.type, t.category_id, t.financialAccount_id, t.profile_id, "
+        "c.category_name, fa.financialAccount_name "
+        "FROM transactions t "
+        "LEFT JOIN category c ON c.id = t.category_id "
+        "LEFT JOIN financialAccount fa ON fa.id = t.financialAccount_id "
+        "WHERE t.profile_id = :profileId"
+    );
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
+
+    query.bindValue(":profileId", profileId);
+
+    if (!exec(query))
+    {
+        qDebug() << "Transaction row retrieval for profile failed:" << query.lastError().text();
+        return result;
+    }
+
+    while (query.next()) {
+        int id = query.value(0).toInt();
+        QString name = query.value(1).toString();
+        QDate date = QDate::fromJulianDay(query.value(2).toLongLong());
+        QString description = query.value(3).toString();
+        Money amount = Money::fromCents(query.value(4).toLongLong());
+        TransactionType type = TransactionTypes::fromStorage(query.value(5).toInt());
+        int categoryId = query.value(6).toInt();
+        int financialAccountId = query.value(7).toInt();
+        int associatedProfileId = query.value(8).toInt();
+        QString categoryName = query.value(9).toString();
+        QString financialAccountName = query.value(10).toString();
+
+        Transaction transaction(id, name, date, description, amount, type, categoryId, financialAccountId, associatedProfileId);
+        result.append(TransactionRow(transaction, categoryName, financialAccountName));
+    }
+
+    return result;
+}
+/**
+ * @brief Drives the join from profiles so SQLite walks transactions through the profile index in profile order,
+ * without a temporary sort. One ExportRow is reused for every row.
+ */
+bool TransactionRepository::forEachUserTransaction(int userId, const std::function<bool(const ExportRow&)>& visitor) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::forEachUserTransaction");
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT p.profile_name, t.id, t.name, t.date, t.description, t.amount, t.type, "
+        "c.category_name, fa.financialAccount_name, fa.financialAccount_type "
+        "FROM profiles p "
+        "JOIN transactions t ON t.profile_id = p.id "
+        "LEFT JOIN category c ON c.id = t.category_id "
+        "LEFT JOIN financialAccount fa ON fa.id = t.financialAccount_id "
+        "WHERE p.user_id = :userId "
+        "ORDER BY p.id"
+    );
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
+
+    query.bindValue(":userId", userId);
+
+    if (!exec(query))
+    {
+        qDebug() << "Transaction export query failed:" << query.lastError().text();
+        return false;
+    }
+
+    const QString unknown = QStringLiteral("Unknown");
+    ExportRow row;
+    while (query.next()) {
+        row.profileName = query.value(0).toString();
+        row.transactionId = query.value(1).toInt();
+        row.name = query.value(2).toString();
+        row.date = QDate::fromJulianDay(query.value(3).toLongLong());
+        row.description = query.value(4).toString();
+        row.amount = Money::fromCents(query.value(5).toLongLong());
+        row.type = TransactionTypes::fromStorage(query.value(6).toInt());
+        row.categoryName = query.value(7).toString();
+
+        const bool hasAccount = !query.isNull(8);
+        row.accountName = hasAccount ? query.value(8).toString() : unknown;
+        row.accountType = hasAccount ? query.value(9).toString() : unknown;
+
+        if (!visitor(row)) return false;
+    }
+
+    return true;
+}
+/**
+ * @brief Turns free text into an FTS5 query: each word becomes a quoted prefix term, all terms are ANDed.
+ */
+static QString buildFullTextQuery(const QString& text)
+{
+    static const QRegularExpression separators(QStringLiteral("[^\\p{L}\\p{N}]+"));
+    QStringList terms;
+    for (const QString& word : text.split(separators, Qt::SkipEmptyParts)) {
+        terms.append(QLatin1Char('"') + word + QStringLiteral("\"*"));
+    }
+    return terms.join(' ');
+}
+/**
+ * @brief Runs a ranked MATCH against transactions_fts restricted to the profile.
+ */
+QVector<int> TransactionRepository::search(int profileId, const QString& query, int limit, bool* ok) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::search");
+    QVector<int> result;
+    if (ok) *ok = true;
+
+    const QString ftsQuery = buildFullTextQuery(query);
+    if (ftsQuery.isEmpty()) return result;
+
+    StatementCache::Handle sqlQueryStatement = cachedQuery(
+        "SELECT t.id FROM transactions_fts f "
+        "JOIN transactions t ON t.id = f.rowid "
+        "WHERE transactions_fts MATCH :query AND t.profile_id = :profileId "
+        "ORDER BY bm25(transactions_fts, 10.0, 5.0, 2.0, 2.0) "
+        "LIMIT :limit"
+    );
+    QSqlQuery& sqlQuery = *sqlQueryStatement;
+    sqlQuery.setForwardOnly(true);
+    sqlQuery.bindValue(":query", ftsQuery);
+    sqlQuery.bindValue(":profileId", profileId);
+    sqlQuery.bindValue(":limit", limit > 0 ? limit : -1);
+
+    if (!exec(sqlQuery))
+    {
+        qDebug() << "TransactionRepository::search error:" << sqlQuery.lastError().text();
+        if (ok) *ok = false;
+        return result;
+    }
+
+    while (sqlQuery.next()) {
+        result.append(sqlQuery.value(0).toInt());
+    }
+    return result;
+}
+/** @brief SQL expression a page is ordered by; names compare case-insensitively, like the grid used to. */
+static QString pageSortExpression(TransactionRepository::SortColumn column)
+{
+    switch (column) {
+    case TransactionRepository::SortColumn::Name:
+        return QStringLiteral("t.name COLLATE NOCASE");
+    case TransactionRepository::SortColumn::Date:
+        return QStringLiteral("t.date");
+    case TransactionRepository::SortColumn::Amount:
+        return QStringLiteral("t.amount");
+    case TransactionRepository::SortColumn::Category:
+        return QStringLiteral("COALESCE(c.category_name, '') COLLATE NOCASE");
+    case TransactionRepository::SortColumn::Account:
+        return QStringLiteral("COALESCE(fa.financialAccount_name, '') COLLATE NOCASE");
+    default:
+        return QStringLiteral("t.id");
+    }
+}
+/**
+ * @brief Builds the page query from a small fixed set of shapes (sort column, direction, which filters apply,
+ * first or later page), so each shape is prepared once and then served from the statement cache.
+ * A filter with no letters or digits (e.g. "#" or "&") yields no FTS terms, so it falls back to a substring
+ * LIKE on the text columns instead of matching nothing.
+ * The keyset condition is written as "key >= v AND (key > v OR id > lastId)" because SQLite turns the first
+ * term into an index range bound, which it does not do for a row-value comparison on a NOCASE column.
+ */
+TransactionRepository::Page TransactionRepository::getTransactionPage(const PageRequest& request) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getTransactionPage");
+    Page page;
+
+    const bool byId = request.sortColumn == SortColumn::Id;
+    const QString sortKey = pageSortExpression(request.sortColumn);
+    const QString direction = request.order == Qt::DescendingOrder ? QStringLiteral("DESC") : QStringLiteral("ASC");
+    const QString beyond = request.order == Qt::DescendingOrder ? QStringLiteral("<") : QStringLiteral(">");
+
+    const QString filter = request.filter.trimmed();
+    const QString ftsQuery = buildFullTextQuery(filter);
+    QStringList matchedTypes;
+    bool dateLike = false;
+    if (!filter.isEmpty()) {
+        for (TransactionType type : { TransactionType::Income, TransactionType::Expense }) {
+            if (QLatin1String(TransactionTypes::toName(type)).contains(filter, Qt::CaseInsensitive)) {
+                matchedTypes.append(QString::number(TransactionTypes::toStorage(type)));
+            }
+        }
+        dateLike = std::all_of(filter.cbegin(), filter.cend(), [](QChar c) { return c.isDigit() || c == '-'; });
+    }
+
+    QString sql =
+        "SELECT t.id, t.name, t.date, t.description, t.amount, t.type, t.category_id, t.financialAccount_id, t.profile_id, "
+        "c.category_name, fa.financialAccount_name, " + sortKey + " "
+        "FROM transactions t "
+        "LEFT JOIN category c ON c.id = t.category_id "
+        "LEFT JOIN financialAccount fa ON fa.id = t.financialAccount_id "
+        "WHERE t.profile_id = :profileId";
+
+    if (!filter.isEmpty()) {
+        QStringList alternatives;
+        if (!ftsQuery.isEmpty()) {
+            alternatives.append("t.id IN (SELECT rowid FROM transactions_fts WHERE transactions_fts MATCH :match)");
+        }
+        else {
+            alternatives.append("t.name LIKE :text ESCAPE '\\' OR t.description LIKE :textDescription ESCAPE '\\' "
+                "OR c.category_name LIKE :textCategory ESCAPE '\\' OR fa.financialAccount_name LIKE :textAccount ESCAPE '\\'");
+        }
+        if (!matchedTypes.isEmpty()) alternatives.append("t.type IN (" + matchedTypes.join(", ") + ")");
+        if (dateLike) alternatives.append("date(t.date) LIKE :dateFragment");
+        if (alternatives.isEmpty()) return page;
+        sql += " AND (" + alternatives.join(" OR ") + ")";
+    }
+
+    if (request.after.isValid()) {
+        if (byId) {
+            sql += " AND t.id " + beyond + " :afterId";
+        }
+        else {
+            sql += " AND " + sortKey + " " + beyond + "= :afterValue AND (" + sortKey + " " + beyond + " :afterValueTie OR t.id " + beyond + " :afterId)";
+        }
+    }
+
+    sql += " ORDER BY " + sortKey + " " + direction;
+    if (!byId) sql += ", t.id " + direction;
+    sql += " LIMIT :limit";
+
+    StatementCache::Handle statement = cachedQuery(sql);
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
+
+    query.bindValue(":profileId", request.profileId);
+    if (!ftsQuery.isEmpty()) {
+        query.bindValue(":match", ftsQuery);
+    }
+    else if (!filter.isEmpty()) {
+        QString escaped = filter;
+        escaped.replace('\\', QStringLiteral("\\\\")).replace('%', QStringLiteral("\\%")).replace('_', QStringLiteral("\\_"));
+        const QString pattern = QLatin1Char('%') + escaped + QLatin1Char('%');
+        query.bindValue(":text", pattern);
+        query.bindValue(":textDescription", pattern);
+        query.bindValue(":textCategory", pattern);
+        query.bindValue(":textAccount", pattern);
+    }
+    if (dateLike) query.bindValue(":dateFragment", QLatin1Char('%') + filter + QLatin1Char('%'));
+    if (request.after.isValid()) {
+        query.bindValue(":afterId", request.after.transactionId);
+        if (!byId) {
+            query.bindValue(":afterValue", request.after.sortValue);
+            query.bindValue(":afterValueTie", request.after.sortValue);
+        }
+    }
+    // One extra row tells whether another page follows.
+    query.bindValue(":limit", request.pageSize + 1);
+
+    if (!exec(query))
+    {
+        qDebug() << "TransactionRepository::getTransactionPage error:" << query.lastError().text();
+        page.ok = false;
+        return page;
+    }
+
+    page.rows.reserve(request.pageSize);
+    while (query.next()) {
+        if (page.rows.size() == request.pageSize) {
+            page.hasMore = true;
+            break;
+        }
+
+        int id = query.value(0).toInt();
+        QString name = query.value(1).toString();
+        QDate date = QDate::fromJulianDay(query.value(2).toLongLong());
+        QString description = query.value(3).toString();
+        Money amount = Money::fromCents(query.value(4).toLongLong());
+        TransactionType type = TransactionTypes::fromStorage(query.value(5).toInt());
+        int categoryId = query.value(6).toInt();
+        int financialAccountId = query.value(7).toInt();
+        int associatedProfileId = query.value(8).toInt();
+        QString categoryName = query.value(9).toString();
+        QString financialAccountName = query.value(10).toString();
+
+        Transaction transaction(id, name, date, description, amount, type, categoryId, financialAccountId, associatedProfileId);
+        page.rows.append(TransactionRow(transaction, categoryName, financialAccountName));
+
+        page.next.transactionId = id;
+        page.next.sortValue = query.value(11);
+    }
+
+    return page;
+}
 /**
  * @brief Retrieves every transaction in the table.
  */
 QVector<Transaction> TransactionRepository::getAll() const
 {
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getAll");
     QVector<Transaction> result;
 
     QSqlQuery query(database);
 
-    if (!query.exec("SELECT id, name, date, description, amount, type, profile_id, category_id, financialAccount_id FROM transactions"))
+    if (!exec(query, "SELECT id, name, date, description, amount, type, profile_id, category_id, financialAccount_id FROM transactions"))
     {
         qDebug() << "TransactionRepository::getAll error:" << query.lastError().text();
         return result;
@@ -61,14 +354,13 @@ QVector<Transaction> TransactionRepository::getAll() const
     {
         int id = query.value(0).toInt();
         QString name = query.value(1).toString();
-        QString dateStr = query.value(2).toString();
+        QDate date = QDate::fromJulianDay(query.value(2).toLongLong());
         QString description = query.value(3).toString();
-        double amount = query.value(4).toDouble();
-        QString type = query.value(5).toString();
+        Money amount = Money::fromCents(query.value(4).toLongLong());
+        TransactionType type = TransactionTypes::fromStorage(query.value(5).toInt());
         int associatedProfileId = query.value(6).toInt();
         int categoryId = query.value(7).toInt();
         int financialAccountId = query.value(8).toInt();
-        QDate date = QDate::fromString(dateStr, "yyyy-MM-dd");
         
         Transaction transaction(id, name, date, description, amount, type, categoryId,financialAccountId, associatedProfileId);
         result.append(transaction);
@@ -81,42 +373,121 @@ QVector<Transaction> TransactionRepository::getAll() const
  */
 bool TransactionRepository::addTransaction(const Transaction& transaction) const
 {
-    QSqlQuery query(database);
-    query.prepare(
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::addTransaction");
+    StatementCache::Handle statement = cachedQuery(
         "INSERT INTO transactions (name, type, date, description, amount, category_id ,financialAccount_id, profile_id) "
         "VALUES (:name, :type, :date, :description, :amount, :category_id, :financialAccount_id, :profile_id)"
     );
+    QSqlQuery& query = *statement;
 
     query.bindValue(":name", transaction.getTransactionName());
-    query.bindValue(":type", transaction.getTransactionType());
-    query.bindValue(":date", transaction.getTransactionDate().toString("yyyy-MM-dd"));
+    query.bindValue(":type", TransactionTypes::toStorage(transaction.getTransactionType()));
+    query.bindValue(":date", transaction.getTransactionDate().toJulianDay());
     query.bindValue(":description", transaction.getTransactionDescription());
-    query.bindValue(":amount", transaction.getTransactionAmount());
+    query.bindValue(":amount", transaction.getTransactionAmount().getCents());
     query.bindValue(":profile_id", transaction.getAssociatedProfileId());
     query.bindValue(":category_id", transaction.getCategoryId());
     query.bindValue(":financialAccount_id", transaction.getFinancialAccountId());
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "TransactionRepository::add error:" << query.lastError().text();
         return false;
     }
+
+    Transaction added = transaction;
+    added.setTransactionId(query.lastInsertId().toInt());
+    TransactionColumnStore::instance().addTransaction(added);
     return true;
 }
+/**
+ * @brief Inserts a batch inside BEGIN/COMMIT with one prepared INSERT bound per row.
+ */
+TransactionRepository::BatchInsertResult TransactionRepository::addTransactions(const QVector<Transaction>& transactions) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::addTransactions");
+    BatchInsertResult result;
+    result.ids.fill(-1, transactions.size());
+    result.errors.reserve(transactions.size());
+    if (transactions.isEmpty()) {
+        result.committed = true;
+        return result;
+    }
+
+    if (!database.transaction()) {
+        qDebug() << "TransactionRepository::addTransactions could not start a transaction:" << database.lastError().text();
+        for (qsizetype i = 0; i < transactions.size(); ++i) result.errors.append(database.lastError().text());
+        return result;
+    }
+
+    StatementCache::Handle statement = cachedQuery(
+        "INSERT INTO transactions (name, type, date, description, amount, category_id ,financialAccount_id, profile_id) "
+        "VALUES (:name, :type, :date, :description, :amount, :category_id, :financialAccount_id, :profile_id)"
+    );
+    QSqlQuery& query = *statement;
+
+    for (qsizetype i = 0; i < transactions.size(); ++i) {
+        const Transaction& transaction = transactions.at(i);
+        query.bindValue(":name", transaction.getTransactionName());
+        query.bindValue(":type", TransactionTypes::toStorage(transaction.getTransactionType()));
+        query.bindValue(":date", transaction.getTransactionDate().toJulianDay());
+        query.bindValue(":description", transaction.getTransactionDescription());
+        query.bindValue(":amount", transaction.getTransactionAmount().getCents());
+        query.bindValue(":profile_id", transaction.getAssociatedProfileId());
+        query.bindValue(":category_id", transaction.getCategoryId());
+        query.bindValue(":financialAccount_id", transaction.getFinancialAccountId());
+
+        if (exec(query)) {
+            result.ids[i] = query.lastInsertId().toInt();
+            result.errors.append(QString());
+            ++result.insertedCount;
+        }
+        else {
+            result.errors.append(query.lastError().text());
+        }
+    }
+
+    if (!database.commit()) {
+        const QString commitError = database.lastError().text();
+        qDebug() << "TransactionRepository::addTransactions commit failed:" << commitError;
+        database.rollback();
+        for (qsizetype i = 0; i < transactions.size(); ++i) {
+            result.ids[i] = -1;
+            if (result.errors.at(i).isEmpty()) result.errors[i] = commitError;
+        }
+        result.insertedCount = 0;
+        return result;
+    }
+
+    result.committed = true;
+    TransactionColumnStore& store = TransactionColumnStore::instance();
+    for (qsizetype i = 0; i < transactions.size(); ++i) {
+        if (result.ids.at(i) < 0) continue;
+        Transaction added = transactions.at(i);
+        added.setTransactionId(result.ids.at(i));
+        store.addTransaction(added);
+    }
+    if (result.insertedCount < transactions.size()) {
+        qDebug() << "TransactionRepository::addTransactions:" << (transactions.size() - result.insertedCount) << "of" << transactions.size() << "rows rejected.";
+    }
+    return result;
+}
 /**
  * @brief Deletes a transaction by ID.
  */
 bool TransactionRepository::removeTransactionById(int id) const
 {
-    QSqlQuery query(database);
-    query.prepare("DELETE FROM transactions WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::removeTransactionById");
+    StatementCache::Handle statement = cachedQuery("DELETE FROM transactions WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":id", id);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "TransactionRepository::removeById error:" << query.lastError().text();
         return false;
     }
 
+    TransactionColumnStore::instance().removeTransaction(id);
     return true;
 }
 /**
@@ -124,9 +495,8 @@ bool TransactionRepository::removeTransactionById(int id) const
  */
 bool TransactionRepository::updateTransaction(const Transaction& transaction) const
 {
-    QSqlQuery query(database);
-
-    query.prepare(
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::updateTransaction");
+    StatementCache::Handle statement = cachedQuery(
         "UPDATE transactions SET "
         "name=:name, "
         "description=:desc, "
@@ -137,20 +507,22 @@ bool TransactionRepository::updateTransaction(const Transaction& transaction) co
         "financialAccount_id=:financialAccountId "
         "WHERE id=:id"
     );
+    QSqlQuery& query = *statement;
 
     query.bindValue(":name", transaction.getTransactionName());
     query.bindValue(":desc", transaction.getTransactionDescription());
-    query.bindValue(":date", transaction.getTransactionDate().toString("yyyy-MM-dd")); 
-    query.bindValue(":amount", transaction.getTransactionAmount());
+    query.bindValue(":date", transaction.getTransactionDate().toJulianDay()); 
+    query.bindValue(":amount", transaction.getTransactionAmount().getCents());
     query.bindValue(":catId", transaction.getCategoryId());
-    query.bindValue(":type", transaction.getTransactionType());
+    query.bindValue(":type", TransactionTypes::toStorage(transaction.getTransactionType()));
     query.bindValue(":id", transaction.getTransactionId());
     query.bindValue(":financialAccountId", transaction.getFinancialAccountId());
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "TransactionRepo::update error:" << query.lastError().text();
         return false;
     }
+    TransactionColumnStore::instance().updateTransaction(transaction);
     return true;
 }
 /**
@@ -158,126 +530,232 @@ bool TransactionRepository::updateTransaction(const Transaction& transaction) co
  */
 Transaction TransactionRepository::getTransactionById(int id) const
 {
-    QSqlQuery query(database);
-    query.prepare("SELECT id, name, date, description, amount, type, category_id, profile_id, financialAccount_id FROM transactions WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getTransactionById");
+    StatementCache::Handle statement = cachedQuery("SELECT id, name, date, description, amount, type, category_id, profile_id, financialAccount_id FROM transactions WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":id", id);
 
-    if (query.exec() && query.next()) {
+    if (exec(query) && query.next()) {
         int tId = query.value(0).toInt();
         QString name = query.value(1).toString();
-        QDate date = QDate::fromString(query.value(2).toString(), "yyyy-MM-dd");
+        QDate date = QDate::fromJulianDay(query.value(2).toLongLong());
         QString desc = query.value(3).toString();
-        double amount = query.value(4).toDouble();
-        QString type = query.value(5).toString();
+        Money amount = Money::fromCents(query.value(4).toLongLong());
+        TransactionType type = TransactionTypes::fromStorage(query.value(5).toInt());
         int catId = query.value(6).toInt();
         int profId = query.value(7).toInt();
         int financialAccountId = query.value(8).toInt();
 
         return Transaction(tId, name, date, desc, amount, type, catId, financialAccountId, profId);
     }
-    return Transaction(-1, "", QDate(), "", 0, "Expense", 1, -1, 1);
+    return Transaction(-1, "", QDate(), "", Money(), TransactionType::Expense, 1, -1, 1);
 }
 /**
- * @brief Aggregates expenses for a specific month using SQLite date functions.
+ * @brief Encodes a date's calendar month as yyyyMM, matching monthly_rollup.year_month.
  */
-double TransactionRepository::getMonthlyExpenses(int profileId, int month, int year) const
+int TransactionRepository::monthKey(const QDate& date)
 {
-    QSqlQuery query(database);
-    query.prepare(
-        "SELECT SUM(amount) "
-        "FROM transactions "
-        "WHERE profile_id = :id "
-        "AND type = 'Expense'"
-        "AND strftime('%m', date) = :month AND strftime('%Y', date) = :year"
-    );
+    return date.year() * 100 + date.month();
+}
+/**
+ * @brief Splits [start, end] into whole months and the partial days before/after them.
+ */
+TransactionRepository::MonthSplit TransactionRepository::splitByMonths(const QDate& start, const QDate& end)
+{
+    MonthSplit split;
+    if (!start.isValid() || !end.isValid() || start > end) return split;
 
-    query.bindValue(":id", profileId);
-    query.bindValue(":month", QString("%1").arg(month, 2, 10, QChar('0')));
-    query.bindValue(":year", QString::number(year));
+    const QDate firstFullDay = start.day() == 1 ? start : QDate(start.year(), start.month(), 1).addMonths(1);
+    const QDate afterEnd = end.addDays(1);
+    const QDate fullEndExclusive = QDate(afterEnd.year(), afterEnd.month(), 1);
 
-    if (query.exec() && query.next()) {
-        return query.value(0).toDouble();
+    if (firstFullDay >= fullEndExclusive) {
+        split.partialRanges.append({ start, end });
+        return split;
     }
-    return 0.0;
+
+    split.hasFullMonths = true;
+    split.firstMonthKey = monthKey(firstFullDay);
+    split.lastMonthKey = monthKey(fullEndExclusive.addMonths(-1));
+    if (start < firstFullDay) split.partialRanges.append({ start, firstFullDay.addDays(-1) });
+    if (fullEndExclusive <= end) split.partialRanges.append({ fullEndExclusive, end });
+    return split;
 }
 /**
- * @brief Calculates sum of Income or Expense within a date range.
+ * @brief Reads one month of expenses from monthly_rollup.
  */
-double TransactionRepository::getSumByTypeAndDate(int profileId, const QString& type, const QDate& start, const QDate& end) const
+Money TransactionRepository::getMonthlyExpenses(int profileId, int month, int year) const
 {
-    QSqlQuery query(database);
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getMonthlyExpenses");
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT SUM(total) FROM monthly_rollup "
+        "WHERE profile_id = :id AND type = :type AND year_month = :yearMonth"
+    );
+    QSqlQuery& query = *statement;
+    query.bindValue(":id", profileId);
+    query.bindValue(":type", TransactionTypes::toStorage(TransactionType::Expense));
+    query.bindValue(":yearMonth", year * 100 + month);
 
+    if (exec(query) && query.next()) {
+        return Money::fromCents(query.value(0).toLongLong());
+    }
+    qDebug() << "TransactionRepository::getMonthlyExpenses error:" << query.lastError().text();
+    return Money();
+}
+/**
+ * @brief Sums whole months from monthly_rollup and only the partial edge days from transactions.
+ */
+Money TransactionRepository::getSumByTypeAndDate(int profileId, TransactionType type, const QDate& start, const QDate& end) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getSumByTypeAndDate");
+    const MonthSplit split = splitByMonths(start, end);
+    qint64 totalCents = 0;
+
+    if (split.hasFullMonths) {
+        StatementCache::Handle rollupQueryStatement = cachedQuery(
+            "SELECT SUM(total) FROM monthly_rollup "
+            "WHERE profile_id = :pid AND type = :type AND year_month BETWEEN :first AND :last"
+        );
+        QSqlQuery& rollupQuery = *rollupQueryStatement;
+        rollupQuery.bindValue(":pid", profileId);
+        rollupQuery.bindValue(":type", TransactionTypes::toStorage(type));
+        rollupQuery.bindValue(":first", split.firstMonthKey);
+        rollupQuery.bindValue(":last", split.lastMonthKey);
+
+        if (exec(rollupQuery) && rollupQuery.next()) {
+            totalCents += rollupQuery.value(0).toLongLong();
+        }
+        else {
+            qDebug() << "TransactionRepository::getSumByTypeAndDate rollup error:" << rollupQuery.lastError().text();
+        }
+    }
 
-    query.prepare(
+    StatementCache::Handle statement = cachedQuery(
         "SELECT SUM(amount) FROM transactions "
-        "WHERE profile_id = :pid AND UPPER(type) = UPPER(:type) "
+        "WHERE profile_id = :pid AND type = :type "
         "AND date >= :start AND date <= :end"
     );
-    query.bindValue(":pid", profileId);
-    query.bindValue(":type", type);
-    query.bindValue(":start", start.toString("yyyy-MM-dd"));
-    query.bindValue(":end", end.toString("yyyy-MM-dd"));
-
-    if (query.exec() && query.next()) {
-
-        return query.value(0).toDouble();
+    QSqlQuery& query = *statement;
+    for (const auto& range : split.partialRanges) {
+        query.bindValue(":pid", profileId);
+        query.bindValue(":type", TransactionTypes::toStorage(type));
+        query.bindValue(":start", range.first.toJulianDay());
+        query.bindValue(":end", range.second.toJulianDay());
+
+        if (exec(query) && query.next()) {
+            totalCents += query.value(0).toLongLong();
+        }
+        else {
+            qDebug() << "TransactionRepository::getSumByTypeAndDate partial range error:" << query.lastError().text();
+        }
     }
 
-    return 0.0;
+    return Money::fromCents(totalCents);
 }
 /**
- * @brief Calculates total expense divided by the number of distinct months with activity.
+ * @brief Calculates total expense divided by the number of distinct months with activity, from monthly_rollup.
  */
-double TransactionRepository::getAllTimeMonthlyAverageExpense(int profileId) const
+Money TransactionRepository::getAllTimeMonthlyAverageExpense(int profileId) const
 {
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getAllTimeMonthlyAverageExpense");
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT SUM(total), COUNT(DISTINCT year_month) "
+        "FROM monthly_rollup WHERE profile_id = :pid AND type = :type"
+    );
+    QSqlQuery& query = *statement;
+    query.bindValue(":pid", profileId);
+    query.bindValue(":type", TransactionTypes::toStorage(TransactionType::Expense));
 
-    QSqlQuery sumQuery(database);
-    sumQuery.prepare("SELECT SUM(amount) FROM transactions WHERE profile_id = :pid AND type = 'Expense'");
-    sumQuery.bindValue(":pid", profileId);
-
-    double totalExpense = 0.0;
-    if (sumQuery.exec() && sumQuery.next()) {
-        totalExpense = sumQuery.value(0).toDouble();
-    }
-
- 
-    QSqlQuery countQuery(database);
- 
-    countQuery.prepare("SELECT COUNT(DISTINCT strftime('%Y-%m', date)) FROM transactions WHERE profile_id = :pid AND type = 'Expense'");
-    countQuery.bindValue(":pid", profileId); 
-
+    qint64 totalExpenseCents = 0;
     int monthCount = 1;
-    if (countQuery.exec() && countQuery.next()) {
-        monthCount = countQuery.value(0).toInt();
+    if (exec(query) && query.next()) {
+        totalExpenseCents = query.value(0).toLongLong();
+        monthCount = query.value(1).toInt();
     }
     if (monthCount == 0) monthCount = 1;
 
-    return totalExpense / monthCount;
+    return Money::fromCents(qRound64(static_cast<double>(totalExpenseCents) / monthCount));
 }
 /**
- * @brief Groups expenses by category ID for use in charts.
+ * @brief Groups expenses by category ID for use in charts; whole months come from monthly_rollup.
  */
-QMap<int, double> TransactionRepository::getExpensesByCategory(int profileId, const QDate& start, const QDate& end) const
+QMap<int, Money> TransactionRepository::getExpensesByCategory(int profileId, const QDate& start, const QDate& end) const
 {
-    QMap<int, double> results;
-    QSqlQuery query(database);
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::getExpensesByCategory");
+    QMap<int, Money> results;
+    const MonthSplit split = splitByMonths(start, end);
+
+    if (split.hasFullMonths) {
+        StatementCache::Handle rollupQueryStatement = cachedQuery("SELECT category_id, SUM(total) FROM monthly_rollup "
+            "WHERE profile_id = :pid AND type = :type AND year_month BETWEEN :first AND :last "
+            "GROUP BY category_id");
+        QSqlQuery& rollupQuery = *rollupQueryStatement;
+        rollupQuery.bindValue(":pid", profileId);
+        rollupQuery.bindValue(":type", TransactionTypes::toStorage(TransactionType::Expense));
+        rollupQuery.bindValue(":first", split.firstMonthKey);
+        rollupQuery.bindValue(":last", split.lastMonthKey);
+
+        if (exec(rollupQuery)) {
+            while (rollupQuery.next()) {
+                results[rollupQuery.value(0).toInt()] += Money::fromCents(rollupQuery.value(1).toLongLong());
+            }
+        }
+        else {
+            qDebug() << "Error getting expenses by category from rollup:" << rollupQuery.lastError().text();
+        }
+    }
 
-    query.prepare("SELECT category_id, SUM(amount) FROM transactions "
-        "WHERE profile_id = :pid AND type = 'Expense' "
+    StatementCache::Handle statement = cachedQuery("SELECT category_id, SUM(amount) FROM transactions "
+        "WHERE profile_id = :pid AND type = :type "
         "AND date >= :start AND date <= :end "
         "GROUP BY category_id");
-
+    QSqlQuery& query = *statement;
+    for (const auto& range : split.partialRanges) {
+        query.bindValue(":pid", profileId);
+        query.bindValue(":type", TransactionTypes::toStorage(TransactionType::Expense));
+        query.bindValue(":start", range.first.toJulianDay());
+        query.bindValue(":end", range.second.toJulianDay());
+
+        if (exec(query)) {
+            while (query.next()) {
+                results[query.value(0).toInt()] += Money::fromCents(query.value(1).toLongLong());
+            }
+        }
+        else {
+            qDebug() << "Error getting expenses by category:" << query.lastError().text();
+        }
+    }
+    return results;
+}
+/**
+ * @brief Reads the profile with one forward-only query straight into the columns; the store's version
+ * is taken before the query so that a write committed meanwhile makes the store reject the load.
+ */
+bool TransactionRepository::loadColumnStore(int profileId) const
+{
+    BMA_TRACE_SCOPE("repository", "TransactionRepository::loadColumnStore");
+    TransactionColumnStore& store = TransactionColumnStore::instance();
+    if (store.isLoaded(profileId)) return true;
+
+    const quint64 version = store.getVersion();
+    StatementCache::Handle statement = cachedQuery(
+        "SELECT id, name, date, description, amount, type, category_id, financialAccount_id "
+        "FROM transactions WHERE profile_id = :pid"
+    );
+    QSqlQuery& query = *statement;
+    query.setForwardOnly(true);
     query.bindValue(":pid", profileId);
-    query.bindValue(":start", start.toString("yyyy-MM-dd"));
-    query.bindValue(":end", end.toString("yyyy-MM-dd"));
 
-    if (query.exec()) {
-        while (query.next()) {
-            results.insert(query.value(0).toInt(), query.value(1).toDouble());
-        }
+    if (!exec(query)) {
+        qDebug() << "TransactionRepository::loadColumnStore error:" << query.lastError().text();
+        return false;
     }
-    else {
-        qDebug() << "Error getting expenses by category:" << query.lastError().text();
+
+    TransactionColumnStore::ProfileColumns columns;
+    while (query.next()) {
+        columns.append(Transaction(query.value(0).toInt(), query.value(1).toString(), QDate::fromJulianDay(query.value(2).toLongLong()),
+            query.value(3).toString(), Money::fromCents(query.value(4).toLongLong()), TransactionTypes::fromStorage(query.value(5).toInt()),
+            query.value(6).toInt(), query.value(7).toInt(), profileId));
     }
-    return results;
-}
\ No newline at end of file
+    return store.storeProfile(profileId, std::move(columns), version);
+}
@@ -5,6 +5,8 @@
 #pragma once
 #include <Model/Repositories/BaseRepository.h>
 #include <Model/Repositories/CategoryRepository.h>
+#include <Model/Repositories/TransactionColumnStore.h>
+#include <functional>
 
  /**
   * @class TransactionRepository
@@ -13,6 +15,80 @@
 class TransactionRepository : public BaseRepository
 {
 public:
+    /**
+     * @struct BatchInsertResult
+     * @brief Outcome of addTransactions, reported per input row.
+     */
+    struct BatchInsertResult
+    {
+        QVector<int> ids;           ///< New ID for each input row, or -1 if that row was rejected.
+        QStringList errors;         ///< Error text for each input row; empty on success.
+        int insertedCount = 0;      ///< Number of rows written.
+        bool committed = false;     ///< False if the whole batch was rolled back.
+    };
+
+    /**
+     * @struct ExportRow
+     * @brief One transaction with every name the CSV export needs, as produced by forEachUserTransaction.
+     */
+    struct ExportRow
+    {
+        QString profileName;
+        int transactionId = -1;
+        QString name;
+        QDate date;
+        QString description;
+        Money amount;
+        TransactionType type = TransactionType::Expense;
+        QString categoryName;
+        QString accountName;        ///< "Unknown" if the account no longer exists.
+        QString accountType;        ///< "Unknown" if the account no longer exists.
+    };
+
+    /**
+     * @enum SortColumn
+     * @brief Orderings supported by getTransactionPage. Every ordering is made total by the transaction ID.
+     */
+    enum class SortColumn { Id, Name, Date, Amount, Category, Account };
+
+    /**
+     * @struct PageCursor
+     * @brief Sort key of the last row of a page; the next page starts strictly after it.
+     */
+    struct PageCursor
+    {
+        QVariant sortValue;         ///< Value of the sort column in the last row (unused for SortColumn::Id).
+        int transactionId = -1;     ///< ID of the last row; -1 means "start from the first row".
+
+        bool isValid() const { return transactionId >= 0; }
+    };
+
+    /**
+     * @struct PageRequest
+     * @brief Parameters of one getTransactionPage call.
+     */
+    struct PageRequest
+    {
+        int profileId = -1;
+        SortColumn sortColumn = SortColumn::Id;
+        Qt::SortOrder order = Qt::AscendingOrder;
+        QString filter;             ///< Free text; matched like search(), plus type names and date fragments.
+        PageCursor after;           ///< Cursor returned with the previous page; invalid for the first page.
+        int pageSize = 256;
+    };
+
+    /**
+     * @struct Page
+     * @brief One page of display-ready rows.
+     */
+    struct Page
+    {
+        QVector<TransactionRow> rows;
+        PageCursor next;            ///< Pass as PageRequest::after to fetch the following page.
+        bool hasMore = false;       ///< True if at least one more row follows.
+        bool ok = true;             ///< False if the query failed.
+    };
+
     TransactionRepository() = default;
     /**
      * @brief Retrieves all transactions in the database.
@@ -27,6 +103,14 @@ public:
      */
     bool addTransaction(const Transaction& transaction) const;
 
+    /**
+     * @brief Inserts many transactions in one database transaction, reusing a single prepared statement.
+     * A row that violates a constraint is reported and skipped; the remaining rows are still inserted.
+     * @param transactions Rows to insert (their IDs are ignored).
+     * @return Per-row IDs and errors.
+     */
+    BatchInsertResult addTransactions(const QVector<Transaction>& transactions) const;
+
     /**
      * @brief Removes a transaction by its ID.
      * @param id The ID of the transaction.
@@ -41,6 +125,44 @@ public:
      */
     QVector<Transaction> getAllProfileTransaction(int profileId) const;
 
+    /**
+     * @brief Retrieves all transactions for a profile together with their category and account names.
+     * Names are resolved with a single joined query instead of one lookup per row.
+     * @param profileId The ID of the profile.
+     * @return A list of display-ready transaction rows.
+     */
+    QVector<TransactionRow> getAllProfileTransactionRows(int profileId) const;
+
+    /**
+     * @brief Returns one page of a profile's transactions, filtered and ordered by SQLite.
+     * Pages are addressed by keyset (the last row's sort value and ID) rather than OFFSET, so every page
+     * is an index range scan of pageSize rows no matter how deep the user has scrolled.
+     * Sorting by category or account name is not index-backed and sorts the profile's rows once per page.
+     * @param request Profile, ordering, filter, cursor and page size.
+     * @return The rows and the cursor of the next page.
+     */
+    Page getTransactionPage(const PageRequest& request) const;
+
+    /**
+     * @brief Streams every transaction of every profile of a user through one forward-only joined query.
+     * Rows are grouped by profile; nothing is accumulated, so memory use does not depend on the row count.
+     * @param userId The ID of the user.
+     * @param visitor Called once per row; return false to stop early.
+     * @return False if the query failed or the visitor stopped it.
+     */
+    bool forEachUserTransaction(int userId, const std::function<bool(const ExportRow&)>& visitor) const;
+
+    /**
+     * @brief Full-text search over name, description, category and account names using the FTS5 index.
+     * Every word of the query must match the start of a word in one of those fields; results are ranked with bm25.
+     * @param profileId The ID of the profile.
+     * @param query Free text typed by the user.
+     * @param limit Maximum number of IDs to return; zero or negative means no limit.
+     * @param ok Optional; set to false if the index could not be queried (callers should fall back to scanning).
+     * @return IDs of matching transactions, best match first.
+     */
+    QVector<int> search(int profileId, const QString& query, int limit, bool* ok = nullptr) const;
+
     /**
      * @brief Updates an existing transaction.
      * @param transaction The Transaction object containing updated data.
@@ -62,24 +184,24 @@ public:
      * @param year The year.
      * @return The total expense amount.
      */
-    double getMonthlyExpenses(int profileId, int month, int year) const;
+    Money getMonthlyExpenses(int profileId, int month, int year) const;
 
     /**
      * @brief Calculates the sum of amounts for a specific type and date range.
      * @param profileId The profile ID.
-     * @param type The transaction type ("Income" or "Expense").
+     * @param type The transaction type.
      * @param start The start date.
      * @param end The end date.
      * @return The calculated sum.
      */
-    double getSumByTypeAndDate(int profileId, const QString& type, const QDate& start, const QDate& end) const;
+    Money getSumByTypeAndDate(int profileId, TransactionType type, const QDate& start, const QDate& end) const;
 
     /**
      * @brief Calculates the average monthly expense across all time.
      * @param profileId The profile ID.
      * @return The average expense amount per month.
      */
-    double getAllTimeMonthlyAverageExpense(int profileId) const;
+    Money getAllTimeMonthlyAverageExpense(int profileId) const;
 
     /**
      * @brief Groups expenses by category within a date range.
@@ -88,5 +210,34 @@ public:
      * @param end The end date.
      * @return A map where Key is Category ID and Value is total amount.
      */
-    QMap<int, double> getExpensesByCategory(int userId, const QDate& start, const QDate& end) const;
+    QMap<int, Money> getExpensesByCategory(int userId, const QDate& start, const QDate& end) const;
+
+    /**
+     * @brief Loads a profile's transactions into the TransactionColumnStore unless they are already there.
+     * Afterwards the store is kept current by this repository's writes, so aggregations over it need no SQL.
+     * @param profileId The ID of the profile.
+     * @return True if the store holds the profile; false if the query failed or a concurrent write
+     * invalidated the load (callers should fall back to the SQL aggregates).
+     */
+    bool loadColumnStore(int profileId) const;
+
+private:
+    /**
+     * @struct MonthSplit
+     * @brief A date range split into whole calendar months, answered from monthly_rollup,
+     * and up to two partial edges, answered from transactions.
+     */
+    struct MonthSplit
+    {
+        bool hasFullMonths = false;                 ///< True if at least one whole month lies inside the range.
+        int firstMonthKey = 0;                      ///< yyyyMM of the first whole month.
+        int lastMonthKey = 0;                       ///< yyyyMM of the last whole month.
+        QVector<QPair<QDate, QDate>> partialRanges; ///< Inclusive day ranges outside the whole months.
+    };
+
+    /** @brief Splits an inclusive date range into whole months and partial edges. */
+    static MonthSplit splitByMonths(const QDate& start, const QDate& end);
+
+    /** @brief Returns yyyyMM for the month containing the date. */
+    static int monthKey(const QDate& date);
 };
\ No newline at end of file
@@ -3,25 +3,28 @@
  * @brief Implementation of the User Repository.
  */
 #include <Model/Repositories/UserRepository.h>
+#include <Model/Repositories/DimensionCache.h>
+#include <Model/Repositories/TransactionColumnStore.h>
 
  /**
   * @brief Generates a salt, hashes the password with SHA-256, and stores the user.
   */
 bool UserRepository::addUser(QString username, QString password) const
 {
+    BMA_TRACE_SCOPE("repository", "UserRepository::addUser");
     QString salt = QUuid::createUuid().toString();
 
     QByteArray dataToHash = (password + salt).toUtf8();
     QString hashedPassword = QString(QCryptographicHash::hash(dataToHash, QCryptographicHash::Sha256).toHex());
 
-    QSqlQuery query(database);
-    query.prepare("INSERT INTO users (username, password_hash, salt) VALUES (:username, :password_hash, :salt)");
+    StatementCache::Handle statement = cachedQuery("INSERT INTO users (username, password_hash, salt) VALUES (:username, :password_hash, :salt)");
+    QSqlQuery& query = *statement;
 
     query.bindValue(":username", username);
     query.bindValue(":password_hash", hashedPassword);
     query.bindValue(":salt", salt);
 
-    if (!query.exec()) {
+    if (!exec(query)) {
         qDebug() << "Registration error:" << query.lastError().text();
         return false;
     }
@@ -32,15 +35,18 @@ bool UserRepository::addUser(QString username, QString password) const
  */
 bool UserRepository::removeUserById(int userId) const
 {
-    QSqlQuery query(database);
-    query.prepare("DELETE FROM users WHERE id = :id");
+    BMA_TRACE_SCOPE("repository", "UserRepository::removeUserById");
+    StatementCache::Handle statement = cachedQuery("DELETE FROM users WHERE id = :id");
+    QSqlQuery& query = *statement;
     query.bindValue(":id", userId);
 
-    if (!query.exec())
+    if (!exec(query))
     {
         qDebug() << "UserRepo::removing user to database error:" << query.lastError().text();
         return false;
     }
+    DimensionCache::instance().clear();
+    TransactionColumnStore::instance().clear();
 
     return true;
 }
@@ -49,11 +55,12 @@ bool UserRepository::removeUserById(int userId) const
  */
 int UserRepository::getUserIdBasedOnUsername(QString username, QString password) const
 {
-    QSqlQuery query(database);
-    query.prepare("SELECT id, password_hash, salt FROM users WHERE username = :username");
+    BMA_TRACE_SCOPE("repository", "UserRepository::getUserIdBasedOnUsername");
+    StatementCache::Handle statement = cachedQuery("SELECT id, password_hash, salt FROM users WHERE username = :username");
+    QSqlQuery& query = *statement;
     query.bindValue(":username", username);
 
-    if (query.exec() && query.next()) {
+    if (exec(query) && query.next()) {
         int userId = query.value(0).toInt();
         QString storedHash = query.value(1).toString();
         QString storedSalt = query.value(2).toString();
@@ -73,11 +80,12 @@ int UserRepository::getUserIdBasedOnUsername(QString username, QString password)
  */
 bool UserRepository::checkIfUserExists(const QString& username) const
 {
-    QSqlQuery query(database);
-    query.prepare("SELECT id FROM users WHERE username = :username");
+    BMA_TRACE_SCOPE("repository", "UserRepository::checkIfUserExists");
+    StatementCache::Handle statement = cachedQuery("SELECT id FROM users WHERE username = :username");
+    QSqlQuery& query = *statement;
     query.bindValue(":username", username);
 
-    if (query.exec() && query.next()) {
+    if (exec(query) && query.next()) {
         return true; 
     }
     return false;
@@ -5,7 +5,7 @@
 #include "Model/Transaction.h"
 
  /** @brief Constructor initializing all fields. */
-Transaction::Transaction(int transactionId, QString transactionName, QDate transactionDate, QString transactionDescription, double transactionAmount, QString transactionType, int categoryId, int financialAccountId, int associatedProfileId)
+Transaction::Transaction(int transactionId, QString transactionName, QDate transactionDate, QString transactionDescription, Money transactionAmount, TransactionType transactionType, int categoryId, int financialAccountId, int associatedProfileId)
 {
 	this->transactionId = transactionId;
 	this->transactionName = transactionName;
@@ -42,12 +42,12 @@ QString Transaction::getTransactionDescription() const
 	return transactionDescription;
 }
 
-double Transaction::getTransactionAmount() const
+Money Transaction::getTransactionAmount() const
 {
 	return transactionAmount;
 }
 
-QString Transaction::getTransactionType() const
+TransactionType Transaction::getTransactionType() const
 {
 	return transactionType;
 }
@@ -88,12 +88,12 @@ void Transaction::setTransactionDescription(const QString& description)
 	transactionDescription = description;
 }
 
-void Transaction::setTransactionAmount(double amount)
+void Transaction::setTransactionAmount(Money amount)
 {
 	transactionAmount = amount;
 }
 
-void Transaction::setTransactionType(QString type)
+void Transaction::setTransactionType(TransactionType type)
 {
 	transactionType = type;
 }
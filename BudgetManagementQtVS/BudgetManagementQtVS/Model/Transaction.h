@@ -5,6 +5,8 @@
 #pragma once
 #include <QString>
 #include <QDate>
+#include "Model/Money.h"
+#include "Model/TransactionType.h"
 
  /**
   * @class Transaction
@@ -17,8 +19,8 @@ private:
 	QString transactionName;        ///< Short name/title.
 	QDate transactionDate;          ///< Date of occurrence.
 	QString transactionDescription; ///< Detailed description.
-	double transactionAmount;       ///< Monetary value.
-	QString transactionType;        ///< "Income" or "Expense".
+	Money transactionAmount;        ///< Monetary value.
+	TransactionType transactionType; ///< Income or Expense.
 	int categoryId;                 ///< Associated Category ID.
 	int financialAccountId;         ///< Associated Financial Account ID.
 	int associatedProfileId;        ///< Associated Profile ID.	
@@ -30,12 +32,12 @@ public:
      * @param transactionDate Date.
      * @param transactionDescription Description.
      * @param transactionAmount Amount.
-     * @param transactionType Type string.
+     * @param transactionType Income or Expense.
      * @param categoryId Category ID.
      * @param financialAccountId Account ID.
      * @param associadedProfileId Profile ID.
      */
-    Transaction(int TransactionId, QString transactionName, QDate transactionDate, QString transactionDescription, double transactionAmount, QString transactionType, int categoryId, int financialAccountId, int associadedProfileId);
+    Transaction(int TransactionId, QString transactionName, QDate transactionDate, QString transactionDescription, Money transactionAmount, TransactionType transactionType, int categoryId, int financialAccountId, int associadedProfileId);
     ~Transaction();
 
     // Getters
@@ -43,11 +45,11 @@ public:
     QString getTransactionName() const;
     QDate getTransactionDate() const;
     QString getTransactionDescription() const;
-    double getTransactionAmount() const;
+    Money getTransactionAmount() const;
     int getCategoryId() const;
     int getFinancialAccountId() const;
     int getAssociatedProfileId() const;
-    QString getTransactionType() const;
+    TransactionType getTransactionType() const;
 
     // Setters
     /** @brief Sets ID. @param id New ID. */
@@ -63,10 +65,10 @@ public:
     void setTransactionDescription(const QString& description);
 
     /** @brief Sets amount. @param amount New amount. */
-    void setTransactionAmount(double amount);
+    void setTransactionAmount(Money amount);
 
     /** @brief Sets type. @param type New type. */
-    void setTransactionType(QString type);
+    void setTransactionType(TransactionType type);
 
     /** @brief Sets category ID. @param id New category ID. */
     void setCategoryId(int id);
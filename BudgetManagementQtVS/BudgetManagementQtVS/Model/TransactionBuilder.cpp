@@ -38,14 +38,14 @@ TransactionBuilder& TransactionBuilder::withDescription(const QString& newDescri
 }
 
 /** @brief Sets Amount. Returns builder reference. */
-TransactionBuilder& TransactionBuilder::withAmount(double newAmount)
+TransactionBuilder& TransactionBuilder::withAmount(Money newAmount)
 {
     amount = newAmount;
     return *this;
 }
 
 /** @brief Sets Type. Returns builder reference. */
-TransactionBuilder& TransactionBuilder::withType(const QString& transactionType)
+TransactionBuilder& TransactionBuilder::withType(TransactionType transactionType)
 {
     type = transactionType;
     return *this;
@@ -30,7 +30,7 @@ public:
     TransactionBuilder& withDescription(const QString& newDescription);
 
     /** @brief Sets Amount. @param newAmount The amount. */
-    TransactionBuilder& withAmount(double newAmount);
+    TransactionBuilder& withAmount(Money newAmount);
 
     /** @brief Sets Category ID. @param newCategoryId The category ID. */
     TransactionBuilder& withCategoryId(int newCategoryId);
@@ -41,8 +41,8 @@ public:
     /** @brief Sets Profile ID. @param newProfileId The profile ID. */
     TransactionBuilder& withProfileId(int newProfileId);
 
-    /** @brief Sets Type. @param transactionType The type string. */
-    TransactionBuilder& withType(const QString& transactionType);
+    /** @brief Sets Type. @param transactionType Income or Expense. */
+    TransactionBuilder& withType(TransactionType transactionType);
 
     /**
      * @brief Finalizes construction and returns the Transaction object.
@@ -54,8 +54,8 @@ private:
     QString name;                       ///< Name buffer.
     QDate date = QDate::currentDate();  ///< Date buffer (defaults to today).
     QString description;                ///< Description buffer.
-    double amount = 0.0;                ///< Amount buffer.
-    QString type = "EXPENSE";           ///< Type buffer (defaults to Expense).
+    Money amount;                       ///< Amount buffer.
+    TransactionType type = TransactionType::Expense; ///< Type buffer (defaults to Expense).
     int categoryId = 1;                 ///< Category ID buffer (defaults to 1).
     int financialAccountId = 1;         ///< Account ID buffer (defaults to 1).
     int profileId = -1;                 ///< Profile ID buffer.               
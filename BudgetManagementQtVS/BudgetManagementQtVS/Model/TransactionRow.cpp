@@ -0,0 +1,25 @@
+/**
+ * @file TransactionRow.cpp
+ * @brief Implementation of the TransactionRow display model.
+ */
+#include "Model/TransactionRow.h"
+
+ /** @brief Constructor initializing member variables. */
+TransactionRow::TransactionRow(const Transaction& transaction, const QString& categoryName, const QString& financialAccountName)
+	: transaction(transaction), categoryName(categoryName), financialAccountName(financialAccountName)
+{ }
+
+const Transaction& TransactionRow::getTransaction() const
+{
+	return transaction;
+}
+
+QString TransactionRow::getCategoryName() const
+{
+	return categoryName;
+}
+
+QString TransactionRow::getFinancialAccountName() const
+{
+	return financialAccountName;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file TransactionRow.h
+ * @brief Header file for the TransactionRow display model class.
+ */
+#pragma once
+#include <QString>
+#include "Model/Transaction.h"
+
+ /**
+  * @class TransactionRow
+  * @brief A transaction together with the names of its category and financial account.
+  * Produced by a single joined query so views never need per-row name lookups.
+  */
+class TransactionRow
+{
+private:
+	Transaction transaction;        ///< The underlying transaction.
+	QString categoryName;           ///< Name of the associated category.
+	QString financialAccountName;   ///< Name of the associated financial account.
+public:
+    /**
+     * @brief Constructs a TransactionRow object.
+     * @param transaction The transaction data.
+     * @param categoryName Name of the associated category.
+     * @param financialAccountName Name of the associated financial account.
+     */
+    TransactionRow(const Transaction& transaction, const QString& categoryName, const QString& financialAccountName);
+
+    /** @brief Returns the underlying transaction. */
+    const Transaction& getTransaction() const;
+    /** @brief Returns the category name. */
+    QString getCategoryName() const;
+    /** @brief Returns the financial account name. */
+    QString getFinancialAccountName() const;
+};
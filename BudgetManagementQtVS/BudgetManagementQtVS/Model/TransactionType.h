@@ -0,0 +1,95 @@
+/**
+ * @file TransactionType.h
+ * @brief Header file for the TransactionType enumeration and its conversions.
+ */
+#pragma once
+#include <QString>
+#include <QStringView>
+
+ /**
+  * @enum TransactionType
+  * @brief Direction of a transaction. The underlying value is what is stored in transactions.type.
+  */
+enum class TransactionType : quint8
+{
+    Expense = 0,    ///< Money leaving the account.
+    Income = 1      ///< Money entering the account.
+};
+
+namespace TransactionTypes
+{
+    /** @brief Display name used by views and exports ("Income" / "Expense"). */
+    constexpr const char* toName(TransactionType type)
+    {
+        return type == TransactionType::Income ? "Income" : "Expense";
+    }
+
+    /** @brief Display name as a QString. */
+    inline QString toString(TransactionType type)
+    {
+        return QString::fromLatin1(toName(type));
+    }
+
+    /** @brief Integer value bound to and compared against the transactions.type column. */
+    constexpr int toStorage(TransactionType type)
+    {
+        return static_cast<int>(type);
+    }
+
+    /** @brief Decodes a transactions.type column value. Anything other than Income is treated as Expense. */
+    constexpr TransactionType fromStorage(int value)
+    {
+        return value == toStorage(TransactionType::Income) ? TransactionType::Income : TransactionType::Expense;
+    }
+
+    /** @brief ASCII case-insensitive comparison of a UI string against a display name. */
+    constexpr bool equalsName(QStringView text, const char* name)
+    {
+        qsizetype i = 0;
+        for (; name[i] != '\0'; ++i)
+        {
+            if (i >= text.size())
+            {
+                return false;
+            }
+            char16_t c = text[i].unicode();
+            char16_t n = static_cast<char16_t>(name[i]);
+            if (c >= u'A' && c <= u'Z') c = static_cast<char16_t>(c + (u'a' - u'A'));
+            if (n >= u'A' && n <= u'Z') n = static_cast<char16_t>(n + (u'a' - u'A'));
+            if (c != n)
+            {
+                return false;
+            }
+        }
+        return i == text.size();
+    }
+
+    /**
+     * @brief Parses a display name ("Income", "EXPENSE", ...).
+     * @param text Text coming from a view or an imported file.
+     * @param type Receives the parsed value on success.
+     * @return True if the text names a known type.
+     */
+    constexpr bool tryParse(QStringView text, TransactionType& type)
+    {
+        if (equalsName(text, toName(TransactionType::Income)))
+        {
+            type = TransactionType::Income;
+            return true;
+        }
+        if (equalsName(text, toName(TransactionType::Expense)))
+        {
+            type = TransactionType::Expense;
+            return true;
+        }
+        return false;
+    }
+
+    /** @brief Parses a display name, falling back to Expense for unknown text. */
+    constexpr TransactionType fromName(QStringView text)
+    {
+        TransactionType type = TransactionType::Expense;
+        tryParse(text, type);
+        return type;
+    }
+}
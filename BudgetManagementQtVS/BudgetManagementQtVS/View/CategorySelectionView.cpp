@@ -3,14 +3,21 @@
  * @brief Implementation of the Category Selection View.
  */
 #include "View/CategorySelectionView.h"
+#include "Diagnostics/Tracer.h"
 #include <QMessageBox>
 
  /**
   * @brief Constructor. Initializes the model, style, and UI.
   */
 CategorySelectionView::CategorySelectionView(QWidget* parent)
-    : QWidget(parent), tableModel(new QStandardItemModel(this))
+    : QWidget(parent)
 {
+    tableModel = new RecordTableModel<Category>({
+        { tr("ID"), [](const Category& c) -> QVariant { return c.getCategoryId(); } },
+        { tr("Category Name"), [](const Category& c) -> QVariant { return c.getCategoryName(); } },
+        },
+        [](const Category& c) { return c.getCategoryId(); }, this);
+
     setupStyle();
     setupUI();
 }
@@ -27,11 +34,16 @@ void CategorySelectionView::setupUI()
     QLabel* viewLabel = new QLabel("Categories Management");
     viewLabel->setObjectName("viewLabel"); 
 
+    loadingLabel = new QLabel("Loading...");
+    loadingLabel->setObjectName("loadingLabel");
+    loadingLabel->hide();
+
     searchEdit = new QLineEdit();
     searchEdit->setPlaceholderText("Search categories...");
     searchEdit->setFixedWidth(300);
 
     headerLayout->addWidget(viewLabel);
+    headerLayout->addWidget(loadingLabel);
     headerLayout->addStretch();
     headerLayout->addWidget(searchEdit);
 
@@ -61,9 +73,6 @@ void CategorySelectionView::setupUI()
     categoryTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
 
 
-    tableModel->setColumnCount(2);
-    tableModel->setHeaderData(0, Qt::Horizontal, tr("ID"));
-    tableModel->setHeaderData(1, Qt::Horizontal, tr("Category Name"));
     categoryTable->setColumnHidden(0, true); 
     categoryTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
 
@@ -80,18 +89,19 @@ void CategorySelectionView::setupUI()
 }
 
 /**
- * @brief Clears the current table model and repopulates it with new data.
+ * @brief Hands the categories to the model; cells are formatted on demand.
  */
-void CategorySelectionView::setCategoryTabHeaders(const QVector<QStringList>& rows) const
+void CategorySelectionView::setCategories(QVector<Category> categories) const
 {
-    tableModel->removeRows(0, tableModel->rowCount());
-
-    for (const QStringList& row : rows) {
-        QList<QStandardItem*> items;
-        for (const QString& value : row)
-            items.append(new QStandardItem(value));
-        tableModel->appendRow(items);
-    }
+    BMA_TRACE_SCOPE("view", "CategorySelectionView::setCategories");
+    tableModel->setRecords(std::move(categories));
+}
+/**
+ * @brief Removes one category row from the model.
+ */
+void CategorySelectionView::removeCategory(int categoryId) const
+{
+    tableModel->removeRecord(categoryId);
 }
 /**
  * @brief Resolves the model index to the hidden ID column to get the Category ID.
@@ -100,9 +110,7 @@ int CategorySelectionView::getSelectedCategoryId() const
 {
     QModelIndex index = categoryTable->currentIndex();
     if (!index.isValid()) return -1;
-    bool ok;
-    int id = tableModel->data(tableModel->index(index.row(), 0)).toInt(&ok);
-    return ok ? id : -1;
+    return tableModel->keyAt(index.row());
 }
 /**
  * @brief Shows a QMessageBox with the specified parameters.
@@ -128,6 +136,7 @@ void CategorySelectionView::setupStyle()
 {
     this->setStyleSheet(
         "QLabel#viewLabel { font-size: 24px; font-weight: bold; color: white; }"
+        "QLabel#loadingLabel { color: #95a5a6; font-style: italic; }"
         "QLineEdit{ padding: 8px; border: 1px solid #444444; border-radius: 5px; background-color: #2d2d2d; color: white; selection-background-color: #3498db; }"
         "QPushButton#actionButtonAdd { background-color: #27ae60; color: white; border-radius: 5px; padding: 8px 15px; font-weight: bold; }"
         "QPushButton#actionButtonDelete { background-color: #c0392b; color: white; border-radius: 5px; padding: 8px 15px; }"
@@ -147,4 +156,15 @@ void CategorySelectionView::onButtonDeleteClicked() { emit deleteCategoryRequest
 /** @brief Emits searchCategoryRequest with the new text. */
 void CategorySelectionView::onSearchTextChanged(const QString& text) { emit searchCategoryRequest(text); }
 /** @brief Emits columnSortRequest with the column index. */
-void CategorySelectionView::onHeaderClicked(int index) { emit columnSortRequest(index); }
\ No newline at end of file
+void CategorySelectionView::onHeaderClicked(int index) { emit columnSortRequest(index); }
+/** @brief Toggles the loading label and busy cursor. */
+void CategorySelectionView::setLoading(bool loading)
+{
+    loadingLabel->setVisible(loading);
+    if (loading) {
+        setCursor(Qt::BusyCursor);
+    }
+    else {
+        unsetCursor();
+    }
+}
@@ -5,7 +5,8 @@
 #pragma once
 
 #include <QWidget>
-#include <QStandardItemModel>
+#include "View/RecordTableModel.h"
+#include "Model/Category.h"
 #include <QTableView>
 #include <QPushButton>
 #include <QLineEdit>
@@ -38,10 +39,15 @@ public:
     ~CategorySelectionView() = default;
 
     /**
-     * @brief Populates the category table with data.
-     * @param rows A vector of string lists containing category data.
+     * @brief Replaces the categories shown in the table.
+     * @param categories Categories in display order.
      */
-    void setCategoryTabHeaders(const QVector<QStringList>& rows) const;
+    void setCategories(QVector<Category> categories) const;
+    /**
+     * @brief Removes a single category from the table.
+     * @param categoryId ID of the removed category.
+     */
+    void removeCategory(int categoryId) const;
     /**
      * @brief Retrieves the ID of the currently selected category.
      * @return The selected category ID, or -1 if none is selected.
@@ -54,6 +60,9 @@ public:
      * @param messageType The type of message ("error" or "info").
      */
     void showMessage(QString header, QString message, QString messageType);
+
+    /** @brief Shows a "Loading..." label and a busy cursor while data is being fetched. */
+    void setLoading(bool loading);
     /**
      * @brief Retrieves the current text from the search bar.
      * @return The search string.
@@ -87,9 +96,10 @@ private slots:
 
 private:
 
-    QStandardItemModel* tableModel;
+    RecordTableModel<Category>* tableModel;
     QTableView* categoryTable;
     QLineEdit* searchEdit;
+    QLabel* loadingLabel;       ///< Visible while a query is pending.
     QPushButton* btnAdd;
     QPushButton* btnEdit;
     QPushButton* btnDelete;
@@ -3,6 +3,7 @@
  * @brief Implementation of the Charts View.
  */
 #include "View/ChartsDialogView.h"
+#include "Diagnostics/Tracer.h"
 
  /**
   * @brief Constructor. Sets up UI, style, and date change connections.
@@ -37,6 +38,11 @@ void ChartsView::setupUI() {
     filterLayout->addWidget(startDateEdit);
     filterLayout->addWidget(new QLabel("To:"));
     filterLayout->addWidget(endDateEdit);
+
+    loadingLabel = new QLabel("Loading...");
+    loadingLabel->setObjectName("loadingLabel");
+    loadingLabel->hide();
+    filterLayout->addWidget(loadingLabel);
     filterLayout->addStretch();
     mainLayout->addLayout(filterLayout);
 
@@ -81,6 +87,7 @@ void ChartsView::setupUI() {
  * @brief Recreates the Pie Series based on provided data and assigns it to the chart.
  */
 void ChartsView::updatePieChart(const QMap<QString, double>& data) {
+    BMA_TRACE_SCOPE("chart", "ChartsView::updatePieChart");
     QPieSeries *series = new QPieSeries();
     
     if (data.isEmpty()) {
@@ -106,6 +113,7 @@ void ChartsView::updatePieChart(const QMap<QString, double>& data) {
  * @brief Recreates the Bar Series for Income and Expenses and attaches axes.
  */
 void ChartsView::updateBarChart(double totalIncome, double totalExpense) {
+    BMA_TRACE_SCOPE("chart", "ChartsView::updateBarChart");
     QBarSet *setIncome = new QBarSet("Income");
     QBarSet *setExpense = new QBarSet("Expenses");
 
@@ -153,6 +161,11 @@ void ChartsView::setupStyle() {
             font-size: 14px;
         }
 
+        QLabel#loadingLabel {
+            color: #95a5a6;
+            font-style: italic;
+        }
+
         QDateEdit {
             background-color: #2d2d2d;
             border: 1px solid #444444;
@@ -248,4 +261,14 @@ void ChartsView::setupStyle() {
 void ChartsView::setIncomeValue(double v) { incomeValLabel->setText(QString::number(v, 'f', 2)); }
 void ChartsView::setExpenseValue(double v) { expenseValLabel->setText(QString::number(v, 'f', 2)); }
 void ChartsView::setAverageValue(double v) { averageValLabel->setText(QString::number(v, 'f', 2)); }
-
+/** @brief Toggles the loading label and busy cursor. */
+void ChartsView::setLoading(bool loading)
+{
+    loadingLabel->setVisible(loading);
+    if (loading) {
+        setCursor(Qt::BusyCursor);
+    }
+    else {
+        unsetCursor();
+    }
+}
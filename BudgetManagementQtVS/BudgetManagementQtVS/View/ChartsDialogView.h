@@ -57,6 +57,9 @@ public:
      */
     void updateBarChart(double totalIncome, double totalExpense);
 
+    /** @brief Shows a "Loading..." label and a busy cursor while data is being fetched. */
+    void setLoading(bool loading);
+
 signals:
     /** @brief Emitted when either start or end date is changed. */
     void dateRangeChanged();
@@ -71,6 +74,7 @@ private:
     QLabel* incomeValLabel;
     QLabel* expenseValLabel;
     QLabel* averageValLabel;
+    QLabel* loadingLabel;       ///< Visible while a query is pending.
     QDateEdit* startDateEdit;
     QDateEdit* endDateEdit;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
  * @brief Implementation of the Financial Account Selection View.
  */
 #include "View/FinancialAccountSelectionView.h"
+#include "Diagnostics/Tracer.h"
 #include <QMessageBox>
 #include <QDialog>
 #include <QFormLayout>
@@ -13,8 +14,18 @@
 
  /** @brief Constructor. Initializes UI and Style. */
 FinancialAccountSelectionView::FinancialAccountSelectionView(QWidget* parent)
-    : QWidget(parent), tableModel(new QStandardItemModel(this))
+    : QWidget(parent)
 {
+    const Qt::Alignment numeric = Qt::AlignRight | Qt::AlignVCenter;
+    tableModel = new RecordTableModel<FinancialAccount>({
+        { tr("ID"), [](const FinancialAccount& a) -> QVariant { return a.getFinancialAccountId(); } },
+        { tr("Account Name"), [](const FinancialAccount& a) -> QVariant { return a.getFinancialAccountName(); } },
+        { tr("Account Type"), [](const FinancialAccount& a) -> QVariant { return a.getFinancialAccountType(); } },
+        { tr("Inital Balance"), [](const FinancialAccount& a) -> QVariant { return a.getFinancialAccountBalance().toString() + " PLN"; }, numeric },
+        { tr("Current Balance"), [](const FinancialAccount& a) -> QVariant { return a.getFinancialAccountCurrentBalance().toString() + " PLN"; }, numeric },
+        },
+        [](const FinancialAccount& a) { return a.getFinancialAccountId(); }, this);
+
     setupUI();
     setupStyle();
 }
@@ -29,11 +40,16 @@ void FinancialAccountSelectionView::setupUI()
     QLabel* viewLabel = new QLabel("Financial Accounts");
     viewLabel->setObjectName("viewLabel"); 
 
+    loadingLabel = new QLabel("Loading...");
+    loadingLabel->setObjectName("loadingLabel");
+    loadingLabel->hide();
+
     searchEdit = new QLineEdit();
     searchEdit->setPlaceholderText("Search accounts...");
     searchEdit->setFixedWidth(300);
 
     headerLayout->addWidget(viewLabel);
+    headerLayout->addWidget(loadingLabel);
     headerLayout->addStretch();
     headerLayout->addWidget(searchEdit);
 
@@ -61,12 +77,6 @@ void FinancialAccountSelectionView::setupUI()
     accountTable->verticalHeader()->setVisible(false);
     accountTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
 
-    tableModel->setColumnCount(5);
-    tableModel->setHeaderData(0, Qt::Horizontal, tr("ID"));
-    tableModel->setHeaderData(1, Qt::Horizontal, tr("Account Name"));
-    tableModel->setHeaderData(2, Qt::Horizontal, tr("Account Type"));
-    tableModel->setHeaderData(3, Qt::Horizontal, tr("Inital Balance"));
-    tableModel->setHeaderData(4, Qt::Horizontal, tr("Current Balance"));
 
     accountTable->setColumnHidden(0, true);
     accountTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
@@ -81,25 +91,18 @@ void FinancialAccountSelectionView::setupUI()
     connect(searchEdit, &QLineEdit::textChanged, this, &FinancialAccountSelectionView::onSearchTextChanged);
     connect(accountTable->horizontalHeader(), &QHeaderView::sectionClicked, this, &FinancialAccountSelectionView::onHeaderClicked);
 }
-/** @brief Rebuilds the table model with new account data. */
-void FinancialAccountSelectionView::setAccountTabHeaders(const QVector<QStringList>& rows) const
+/** @brief Hands the accounts to the model; cells are formatted on demand. */
+void FinancialAccountSelectionView::setAccounts(QVector<FinancialAccount> accounts) const
 {
-    tableModel->removeRows(0, tableModel->rowCount());
-    for (const QStringList& row : rows) {
-        QList<QStandardItem*> items;
-        for (const QString& value : row)
-            items.append(new QStandardItem(value));
-        tableModel->appendRow(items);
-    }
+    BMA_TRACE_SCOPE("view", "FinancialAccountSelectionView::setAccounts");
+    tableModel->setRecords(std::move(accounts));
 }
 /** @brief Helper to get the ID from the hidden first column of the selected row. */
 int FinancialAccountSelectionView::getSelectedAccountId() const
 {
     QModelIndex index = accountTable->currentIndex();
     if (!index.isValid()) return -1;
-    bool ok;
-    int id = tableModel->data(tableModel->index(index.row(), 0)).toInt(&ok);
-    return ok ? id : -1;
+    return tableModel->keyAt(index.row());
 }
 /** @brief Display helper for QMessageBox. */
 void FinancialAccountSelectionView::showMessage(QString header, QString message, QString messageType)
@@ -161,15 +164,15 @@ void FinancialAccountSelectionView::onButtonEditClicked()
 {
 
 
-    int row = accountTable->currentIndex().row();
-    if (row < 0) {
+    const FinancialAccount* account = tableModel->recordAt(accountTable->currentIndex().row());
+    if (!account) {
         showMessage("Warning", "Select an account to edit.", "error");
         return;
     }
 
 
-    int id = tableModel->data(tableModel->index(row, 0)).toInt(); 
-    QString currentName = tableModel->data(tableModel->index(row, 1)).toString(); 
+    int id = account->getFinancialAccountId();
+    QString currentName = account->getFinancialAccountName();
 
 
 
@@ -212,6 +215,7 @@ void FinancialAccountSelectionView::setupStyle()
 {
     this->setStyleSheet(
         "QLabel#viewLabel { font-size: 24px; font-weight: bold; color: white; }"
+        "QLabel#loadingLabel { color: #95a5a6; font-style: italic; }"
         "QLineEdit{ padding: 8px; border: 1px solid #444444; border-radius: 5px; background-color: #2d2d2d; color: white; selection-background-color: #3498db; }"
         "QPushButton#actionButtonAdd { background-color: #27ae60; color: white; border-radius: 5px; padding: 8px 15px; font-weight: bold; }"
         "QPushButton#actionButtonDelete { background-color: #c0392b; color: white; border-radius: 5px; padding: 8px 15px; }"
@@ -226,4 +230,15 @@ void FinancialAccountSelectionView::onButtonDeleteClicked() { emit deleteAccount
 /** @brief Emits searchAccountRequest. */
 void FinancialAccountSelectionView::onSearchTextChanged(const QString& text) { emit searchAccountRequest(text); }
 /** @brief Emits columnSortRequest. */
-void FinancialAccountSelectionView::onHeaderClicked(int index) { emit columnSortRequest(index); }
\ No newline at end of file
+void FinancialAccountSelectionView::onHeaderClicked(int index) { emit columnSortRequest(index); }
+/** @brief Toggles the loading label and busy cursor. */
+void FinancialAccountSelectionView::setLoading(bool loading)
+{
+    loadingLabel->setVisible(loading);
+    if (loading) {
+        setCursor(Qt::BusyCursor);
+    }
+    else {
+        unsetCursor();
+    }
+}
@@ -5,7 +5,8 @@
 #pragma once
 
 #include <QWidget>
-#include <QStandardItemModel>
+#include "View/RecordTableModel.h"
+#include "Model/FinancialAccount.h"
 #include <QTableView>
 #include <QPushButton>
 #include <QLineEdit>
@@ -27,10 +28,10 @@ public:
     explicit FinancialAccountSelectionView(QWidget* parent = nullptr);
 
     /**
-     * @brief Populates the account table with data.
-     * @param rows Vector of string lists containing account details.
+     * @brief Replaces the accounts shown in the table.
+     * @param accounts Accounts in display order.
      */
-    void setAccountTabHeaders(const QVector<QStringList>& rows) const;
+    void setAccounts(QVector<FinancialAccount> accounts) const;
 
     /** @brief Returns the ID of the selected account. */
     int getSelectedAccountId() const;
@@ -43,6 +44,9 @@ public:
      */
     void showMessage(QString header, QString message, QString messageType);
 
+    /** @brief Shows a "Loading..." label and a busy cursor while data is being fetched. */
+    void setLoading(bool loading);
+
     /** @brief Returns text from the search bar. */
     QString getSearchText() const;
 
@@ -87,9 +91,10 @@ private slots:
     void onHeaderClicked(int index);
 
 private:
-    QStandardItemModel* tableModel;
+    RecordTableModel<FinancialAccount>* tableModel;
     QTableView* accountTable;
     QLineEdit* searchEdit;
+    QLabel* loadingLabel;       ///< Visible while a query is pending.
     QPushButton* btnAdd;
     QPushButton* btnEdit;
     QPushButton* btnDelete;
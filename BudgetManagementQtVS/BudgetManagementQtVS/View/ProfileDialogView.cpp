@@ -33,6 +33,7 @@ void ProfileDialog::setupConnections()
     connect(ui->buttonEdit, &QPushButton::clicked, this, &ProfileDialog::onButtonEditClicked);
     connect(ui->buttonLogout, &QPushButton::clicked, this, &ProfileDialog::onButtonLogoutClicked);
     connect(ui->buttonExport, &QPushButton::clicked, this, &ProfileDialog::onButtonExportClicked);
+    connect(ui->buttonImport, &QPushButton::clicked, this, &ProfileDialog::onButtonImportClicked);
 }
 /** @brief Clears and repopulates the profile list widget. */
 void ProfileDialog::setProfiles(const QVector<Profile>& profiles)
@@ -116,6 +117,11 @@ void ProfileDialog::onButtonExportClicked()
 {
     emit exportDataRequested();
 }
+/** @brief Emits importDataRequested. */
+void ProfileDialog::onButtonImportClicked()
+{
+    emit importDataRequested();
+}
 /** @brief Sets CSS styling. */
 void ProfileDialog::setupStyle()
 {
@@ -127,6 +133,7 @@ void ProfileDialog::setupStyle()
         "QPushButton#buttonEdit { background-color: #2980b9; }"
         "QPushButton#buttonLogout { background-color: #2980b9; }"
         "QPushButton#buttonExport { background-color: #2980b9; }"
+        "QPushButton#buttonImport { background-color: #2980b9; }"
         "QPushButton#buttonExit { background-color: #c0392b; }" 
         "QListWidget { background-color: #2d2d2d; font-weight: bold; padding: 10px; border: 1px solid #444444; }"
 		"QListWidget::item { height: 20px; color: white; font-weight: bold; padding: 10px; }"
@@ -64,6 +64,8 @@ signals:
     void logoutRequested();
     /** @brief Emitted to export user data. */
     void exportDataRequested();
+    /** @brief Emitted to import user data from a CSV export. */
+    void importDataRequested();
 
 private slots:
     void onButtonSelectClicked();
@@ -73,6 +75,7 @@ private slots:
     void onButtonEditClicked();
     void onButtonLogoutClicked();
     void onButtonExportClicked();
+    void onButtonImportClicked();
 private:
     Ui::ProfileDialog* ui;          
     QVector<Profile> profilesId;    
@@ -0,0 +1,257 @@
+/**
+ * @file RecordTableModel.h
+ * @brief Header file for the generic record-backed table model used by the list views.
+ */
+#pragma once
+
+#include <QAbstractTableModel>
+#include <QVector>
+#include <QString>
+#include <QVariant>
+#include <functional>
+#include <utility>
+
+ /**
+  * @class RecordTableModel
+  * @brief Read-only table model that keeps typed records in one contiguous vector and formats cells lazily in data().
+  * Rows are exposed to the view in batches through canFetchMore()/fetchMore(), so only visible rows are ever formatted.
+  * When the records are only the first page of a larger result, a fetch handler is called once every held record is
+  * shown; the owner loads the next page asynchronously and hands it over with appendRecords().
+  * Single-record edits emit fine-grained dataChanged/rowsInserted/rowsRemoved instead of resetting the model.
+  * @tparam Record Value type of one row (e.g. TransactionRow, Category).
+  */
+template <typename Record>
+class RecordTableModel : public QAbstractTableModel
+{
+public:
+    /**
+     * @struct Column
+     * @brief Describes one column: its header and how a record is rendered in it.
+     */
+    struct Column
+    {
+        QString header;                                     ///< Horizontal header text.
+        std::function<QVariant(const Record&)> display;     ///< Produces the DisplayRole value.
+        Qt::Alignment alignment = Qt::AlignLeft | Qt::AlignVCenter; ///< TextAlignmentRole value.
+    };
+
+    /** @brief Returns the unique key (database ID) of a record. */
+    using KeyFunction = std::function<int(const Record&)>;
+
+    /** @brief Requests the next page of records from the owner. */
+    using FetchHandler = std::function<void()>;
+
+    /**
+     * @brief Constructs the model.
+     * @param modelColumns Column definitions, in display order.
+     * @param recordKey Function returning the unique ID of a record.
+     * @param parent Parent QObject.
+     */
+    RecordTableModel(QVector<Column> modelColumns, KeyFunction recordKey, QObject* parent = nullptr)
+        : QAbstractTableModel(parent), columns(std::move(modelColumns)), keyOf(std::move(recordKey))
+    {
+    }
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : loadedCount;
+    }
+
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : static_cast<int>(columns.size());
+    }
+
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override
+    {
+        if (!index.isValid() || index.row() >= loadedCount || index.column() >= columns.size()) return QVariant();
+
+        const Column& column = columns.at(index.column());
+        switch (role) {
+        case Qt::DisplayRole:
+            return column.display(records.at(index.row()));
+        case Qt::TextAlignmentRole:
+            return static_cast<int>(column.alignment);
+        default:
+            return QVariant();
+        }
+    }
+
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override
+    {
+        if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0 && section < columns.size()) {
+            return columns.at(section).header;
+        }
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    bool canFetchMore(const QModelIndex& parent) const override
+    {
+        if (parent.isValid()) return false;
+        return loadedCount < records.size() || (moreAvailable && !morePending && fetchHandler);
+    }
+
+    void fetchMore(const QModelIndex& parent) override
+    {
+        if (parent.isValid()) return;
+        const int remaining = static_cast<int>(records.size()) - loadedCount;
+        const int batch = qMin(remaining, fetchBatchSize);
+        if (batch <= 0) {
+            if (moreAvailable && !morePending && fetchHandler) {
+                morePending = true;
+                fetchHandler();
+            }
+            return;
+        }
+
+        beginInsertRows(QModelIndex(), loadedCount, loadedCount + batch - 1);
+        loadedCount += batch;
+        endInsertRows();
+    }
+
+    /**
+     * @brief Sets the callback asked for the next page once every held record is shown.
+     * @param handler Called at most once per page; the owner answers with appendRecords() or setMoreAvailable(false).
+     */
+    void setFetchHandler(FetchHandler handler) { fetchHandler = std::move(handler); }
+
+    /**
+     * @brief Declares whether records beyond those held exist, and ends any pending page request.
+     * @param available True if the fetch handler should be asked for another page.
+     */
+    void setMoreAvailable(bool available)
+    {
+        moreAvailable = available;
+        morePending = false;
+    }
+
+    /**
+     * @brief Appends a page of records and shows it immediately if every earlier row is already shown.
+     * Ends the pending page request.
+     * @param page Records in display order, following the ones already held.
+     * @param hasMore True if yet another page exists.
+     */
+    void appendRecords(QVector<Record> page, bool hasMore)
+    {
+        moreAvailable = hasMore;
+        morePending = false;
+        if (page.isEmpty()) return;
+
+        if (loadedCount == records.size()) {
+            beginInsertRows(QModelIndex(), loadedCount, loadedCount + static_cast<int>(page.size()) - 1);
+            records.append(std::move(page));
+            loadedCount = static_cast<int>(records.size());
+            endInsertRows();
+        }
+        else {
+            records.append(std::move(page));
+        }
+    }
+
+    /**
+     * @brief Replaces all records. Only the first batch becomes visible; the view pulls the rest on scroll.
+     * @param newRecords Records in display order.
+     * @param hasMore True if newRecords is only the first page and the fetch handler can supply more.
+     */
+    void setRecords(QVector<Record> newRecords, bool hasMore = false)
+    {
+        beginResetModel();
+        records = std::move(newRecords);
+        loadedCount = static_cast<int>(qMin<qsizetype>(records.size(), fetchBatchSize));
+        moreAvailable = hasMore;
+        morePending = false;
+        endResetModel();
+    }
+
+    /**
+     * @brief Appends a record at the end. It is shown immediately only if every earlier row is already loaded.
+     * @param record The new record.
+     */
+    void appendRecord(const Record& record)
+    {
+        if (loadedCount == records.size()) {
+            beginInsertRows(QModelIndex(), loadedCount, loadedCount);
+            records.append(record);
+            ++loadedCount;
+            endInsertRows();
+        }
+        else {
+            records.append(record);
+        }
+    }
+
+    /**
+     * @brief Replaces the record with the same key in place and repaints only that row.
+     * @param record The updated record.
+     * @return False if no record with that key is present.
+     */
+    bool updateRecord(const Record& record)
+    {
+        const int row = rowOfKey(keyOf(record));
+        if (row < 0) return false;
+
+        records[row] = record;
+        if (row < loadedCount) {
+            emit dataChanged(index(row, 0), index(row, static_cast<int>(columns.size()) - 1));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the record with the given key.
+     * @param key Record ID.
+     * @return False if no record with that key is present.
+     */
+    bool removeRecord(int key)
+    {
+        const int row = rowOfKey(key);
+        if (row < 0) return false;
+
+        if (row < loadedCount) {
+            beginRemoveRows(QModelIndex(), row, row);
+            records.remove(row);
+            --loadedCount;
+            endRemoveRows();
+        }
+        else {
+            records.remove(row);
+        }
+        return true;
+    }
+
+    /** @brief Returns the record at a (loaded) row, or nullptr if out of range. */
+    const Record* recordAt(int row) const
+    {
+        return (row >= 0 && row < loadedCount) ? &records.at(row) : nullptr;
+    }
+
+    /** @brief Returns the key of the record at a row, or -1 if out of range. */
+    int keyAt(int row) const
+    {
+        const Record* record = recordAt(row);
+        return record ? keyOf(*record) : -1;
+    }
+
+    /** @brief Returns the row holding the given key, or -1. */
+    int rowOfKey(int key) const
+    {
+        for (qsizetype i = 0; i < records.size(); ++i) {
+            if (keyOf(records.at(i)) == key) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    /** @brief Returns every record held by the model, including rows not yet fetched by the view. */
+    const QVector<Record>& allRecords() const { return records; }
+
+private:
+    static constexpr int fetchBatchSize = 256;  ///< Rows exposed per fetchMore() call.
+
+    QVector<Column> columns;    ///< Column definitions.
+    KeyFunction keyOf;          ///< Extracts the record ID.
+    QVector<Record> records;    ///< Contiguous row store.
+    int loadedCount = 0;        ///< Number of leading records visible to the view.
+    FetchHandler fetchHandler;  ///< Asks the owner for the next page; empty if all records are always held.
+    bool moreAvailable = false; ///< True if the owner has records beyond those held.
+    bool morePending = false;   ///< True while a page request is outstanding.
+};
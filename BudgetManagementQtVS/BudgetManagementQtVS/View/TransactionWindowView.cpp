@@ -3,14 +3,29 @@
  * @brief Implementation of the Transaction Window View.
  */
 #include "View/TransactionWindowView.h"
+#include "Diagnostics/Tracer.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFrame>
 
  /** @brief Constructor. Initializes UI, Style, and Connections. */
 TransactionWindow::TransactionWindow(QWidget* parent)
-    : QWidget(parent), tableModel(new QStandardItemModel(this))
+    : QWidget(parent)
 {
+    const Qt::Alignment numeric = Qt::AlignRight | Qt::AlignVCenter;
+    tableModel = new RecordTableModel<TransactionRow>({
+        { "ID", [](const TransactionRow& r) -> QVariant { return r.getTransaction().getTransactionId(); } },
+        { "Name", [](const TransactionRow& r) -> QVariant { return r.getTransaction().getTransactionName(); } },
+        { "Date", [](const TransactionRow& r) -> QVariant { return r.getTransaction().getTransactionDate().toString("yyyy-MM-dd"); } },
+        { "Description", [](const TransactionRow& r) -> QVariant { return r.getTransaction().getTransactionDescription(); } },
+        { "Amount", [](const TransactionRow& r) -> QVariant { return r.getTransaction().getTransactionAmount().toString(); }, numeric },
+        { "Type", [](const TransactionRow& r) -> QVariant { return TransactionTypes::toString(r.getTransaction().getTransactionType()); } },
+        { "Category", [](const TransactionRow& r) -> QVariant { return r.getCategoryName(); } },
+        { "Account", [](const TransactionRow& r) -> QVariant { return r.getFinancialAccountName(); } },
+        },
+        [](const TransactionRow& r) { return r.getTransaction().getTransactionId(); }, this);
+    tableModel->setFetchHandler([this]() { emit moreTransactionsRequested(); });
+
     setupUI();
     setupStyle();
     setupConnections();
@@ -31,16 +46,32 @@ QLayout* TransactionWindow::createHeaderSection()
     QLabel* viewLabel = new QLabel("Transactions Overview");
     viewLabel->setObjectName("viewLabel");
 
+    loadingLabel = new QLabel("Loading...");
+    loadingLabel->setObjectName("loadingLabel");
+    loadingLabel->hide();
+
     searchEdit = new QLineEdit();
     searchEdit->setPlaceholderText("Search transactions...");
     searchEdit->setFixedWidth(300);
 
     layout->addWidget(viewLabel);
+    layout->addWidget(loadingLabel);
     layout->addStretch();
     layout->addWidget(searchEdit);
 
     return layout;
 }
+/** @brief Toggles the loading label and busy cursor. */
+void TransactionWindow::setLoading(bool loading)
+{
+    loadingLabel->setVisible(loading);
+    if (loading) {
+        setCursor(Qt::BusyCursor);
+    }
+    else {
+        unsetCursor();
+    }
+}
 /** @brief Creates the Budget section (Progress Bar + Set Limit button). */
 QWidget* TransactionWindow::createBudgetSection()
 {
@@ -102,8 +133,6 @@ void TransactionWindow::setupUI()
 void TransactionWindow::initializeTable() const
 {
     transactionTable->setModel(tableModel);
-    QStringList headers = { "ID", "Name", "Date", "Description", "Amount", "Type", "Category", "Account" };
-    tableModel->setHorizontalHeaderLabels(headers);
 
     transactionTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
     transactionTable->setColumnHidden(0, true);
@@ -116,27 +145,44 @@ void TransactionWindow::initializeTable() const
 /** @brief Connects search edit and table headers to signals. */
 void TransactionWindow::setupConnections()
 {
-    connect(searchEdit, &QLineEdit::textChanged, this, [this](const QString& text) {
-        emit searchTextRequest(text);
+    searchDebounceTimer = new QTimer(this);
+    searchDebounceTimer->setSingleShot(true);
+    searchDebounceTimer->setInterval(250);
+
+    connect(searchEdit, &QLineEdit::textChanged, searchDebounceTimer, qOverload<>(&QTimer::start));
+    connect(searchDebounceTimer, &QTimer::timeout, this, [this]() {
+        emit searchTextRequest(searchEdit->text());
+        });
+    connect(searchEdit, &QLineEdit::returnPressed, this, [this]() {
+        searchDebounceTimer->stop();
+        emit searchTextRequest(searchEdit->text());
         });
 
     connect(transactionTable->horizontalHeader(), &QHeaderView::sectionClicked, this, [this](int logicalIndex) {
         emit columnSortRequest(logicalIndex);
         });
 }
-/** @brief Clears and repopulates the table model with rows. */
-void TransactionWindow::setTransactionTabHeaders(const QVector<QStringList>& rows) const
-{
-    tableModel->removeRows(0, tableModel->rowCount());
-    for (const QStringList& row : rows) {
-        QList<QStandardItem*> items;
-        for (const QString& value : row) items.append(new QStandardItem(value));
-        tableModel->appendRow(items);
-    }
+/** @brief Hands the rows to the model; cells are formatted only when the table paints them. */
+void TransactionWindow::setTransactions(QVector<TransactionRow> rows, bool hasMore) const
+{
+    BMA_TRACE_SCOPE("view", "TransactionWindow::setTransactions");
+    tableModel->setRecords(std::move(rows), hasMore);
+}
+/** @brief Appends a page to the model. */
+void TransactionWindow::appendTransactions(QVector<TransactionRow> rows, bool hasMore) const
+{
+    BMA_TRACE_SCOPE("view", "TransactionWindow::appendTransactions");
+    tableModel->appendRecords(std::move(rows), hasMore);
+}
+/** @brief Removes one row from the model. */
+void TransactionWindow::removeTransaction(int transactionId) const
+{
+    tableModel->removeRecord(transactionId);
 }
 /** @brief Calculates percentage and updates progress bar and label text. */
 void TransactionWindow::updateBudgetDisplay(double limit, double spent) const
 {
+    BMA_TRACE_SCOPE("view", "TransactionWindow::updateBudgetDisplay");
     double percentage = (limit > 0) ? (spent / limit) * 100.0 : 0.0;
     budgetProgressBar->setValue(percentage > 100 ? 100 : static_cast<int>(percentage));
     budgetLabel->setText(QString("Budget: %1 / %2 PLN (Remaining: %3 PLN)")
@@ -147,7 +193,7 @@ int TransactionWindow::getSelectedTransactionId() const
 {
     QModelIndex index = transactionTable->currentIndex();
     if (!index.isValid()) return -1;
-    return tableModel->data(tableModel->index(index.row(), 0)).toInt();
+    return tableModel->keyAt(index.row());
 }
 /** @brief Display helper for QMessageBox. */
 void TransactionWindow::showTransactionMessage(const QString& header, const QString& message, const QString& messageType)
@@ -163,6 +209,7 @@ void TransactionWindow::setupStyle()
     this->setStyleSheet(
         "QWidget { color: white; background-color: transparent; }"
         "QLabel#viewLabel { font-size: 24px; font-weight: bold; color: white; }"
+        "QLabel#loadingLabel { color: #95a5a6; font-style: italic; }"
         "QLineEdit { padding: 8px; border: 1px solid #444444; border-radius: 5px; background-color: #2d2d2d; color: white; }"
         "QFrame#budgetFrame { background-color: #1e1e1e; border-radius: 10px; border: 1px solid #333333; padding: 10px; }"
         "QProgressBar { border: none; background-color: #2d2d2d; border-radius: 7px; text-align: center; }"
@@ -5,7 +5,8 @@
 #pragma once
 
 #include <QWidget>
-#include <QStandardItemModel>
+#include "View/RecordTableModel.h"
+#include "Model/TransactionRow.h"
 #include <QTableView>
 #include <QPushButton>
 #include <QLabel>
@@ -14,6 +15,7 @@
 #include <QMap>
 #include <QHeaderView>
 #include <QMessageBox>
+#include <QTimer>
 
  /**
   * @class TransactionWindow
@@ -28,10 +30,21 @@ public:
     explicit TransactionWindow(QWidget* parent = nullptr);
 
     /**
-     * @brief Populates the transaction table model.
-     * @param rows Vector of string lists containing transaction details.
+     * @brief Replaces the rows shown in the transaction table.
+     * @param rows Transactions with resolved category and account names, in display order.
+     * @param hasMore True if rows is the first page; scrolling to its end emits moreTransactionsRequested().
      */
-    void setTransactionTabHeaders(const QVector<QStringList>& rows) const;
+    void setTransactions(QVector<TransactionRow> rows, bool hasMore = false) const;
+
+    /**
+     * @brief Appends the next page to the transaction table.
+     * @param rows Rows following those already shown.
+     * @param hasMore True if yet another page exists.
+     */
+    void appendTransactions(QVector<TransactionRow> rows, bool hasMore) const;
+
+    /** @brief Removes a single transaction from the table. @param transactionId ID of the removed transaction. */
+    void removeTransaction(int transactionId) const;
 
     /** @brief Returns ID of selected transaction. */
     int getSelectedTransactionId() const;
@@ -49,6 +62,9 @@ public:
     /** @brief Shows transaction related messages. */
     void showTransactionMessage(const QString& header, const QString& message, const QString& messageType);
 
+    /** @brief Shows a "Loading..." label and a busy cursor while data is being fetched. */
+    void setLoading(bool loading);
+
 signals:
     void addTransactionRequest();
     void deleteTransactionRequest();
@@ -56,6 +72,8 @@ signals:
     void editBudgetRequest();
     void columnSortRequest(int columnId);
     void searchTextRequest(const QString& searchText);
+    /** @brief Emitted when the user scrolls past the last loaded page. */
+    void moreTransactionsRequested();
 
 private slots:
     void onButtonAddClicked() { emit addTransactionRequest(); }
@@ -68,10 +86,12 @@ private:
     QPushButton* createButton(const QString& text, const QString& objName, void (TransactionWindow::* slot)());
     QLayout* createHeaderSection();
 
-    QStandardItemModel* tableModel;
+    RecordTableModel<TransactionRow>* tableModel;
     QLineEdit* searchEdit;
+    QTimer* searchDebounceTimer;    ///< Coalesces keystrokes into a single searchTextRequest.
     QProgressBar* budgetProgressBar;
     QLabel* budgetLabel;
+    QLabel* loadingLabel;       ///< Visible while a query is pending.
     QTableView* transactionTable;
 
     QWidget* createBudgetSection();
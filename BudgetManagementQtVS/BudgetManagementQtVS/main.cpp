@@ -3,6 +3,10 @@
  * @brief Main entry point of the Budget Management Application.
  */
 #include "Controller/AppController.h"
+#include "Model/Repositories/FinancialAccountRepository.h"
+#include "Diagnostics/Tracer.h"
+#include <QCommandLineParser>
+#include <QMessageBox>
 
  /**
   * @brief Main function.
@@ -11,8 +15,40 @@
 int main(int argc, char* argv[])
 {
     QApplication app(argc, argv);
-    // Initialize Database Singleton
-    DatabaseManager::instance();
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption verifyBalancesOption("verify-balances", "Recompute account balances, report drift and exit.");
+    QCommandLineOption rebuildBalancesOption("rebuild-balances", "Recompute account balances, repair drift and exit.");
+    QCommandLineOption traceOption("trace", "Write a Chrome trace of the session to this file at exit (tracing builds only).", "file");
+    parser.addOption(verifyBalancesOption);
+    parser.addOption(rebuildBalancesOption);
+    parser.addOption(traceOption);
+    parser.process(app);
+
+#if BMA_TRACING_ENABLED
+    if (parser.isSet(traceOption)) {
+        Tracer::instance().setOutputPath(parser.value(traceOption));
+    }
+#endif
+
+    // Initialize Database Singleton; refuse to run on a partly migrated schema
+    DatabaseManager& databaseManager = DatabaseManager::instance();
+    if (!databaseManager.isSchemaCurrent()) {
+        qCritical() << databaseManager.getSchemaError();
+        if (!parser.isSet(verifyBalancesOption) && !parser.isSet(rebuildBalancesOption)) {
+            QMessageBox::critical(nullptr, QObject::tr("Database upgrade failed"),
+                QObject::tr("The database could not be upgraded, so the application cannot start.\n\n%1").arg(databaseManager.getSchemaError()));
+        }
+        return 1;
+    }
+
+    // Maintenance commands run headless and exit
+    if (parser.isSet(verifyBalancesOption) || parser.isSet(rebuildBalancesOption)) {
+        const bool rebuild = parser.isSet(rebuildBalancesOption);
+        const int drifted = FinancialAccountRepository().verifyBalances(rebuild);
+        return (drifted == 0 || (rebuild && drifted > 0)) ? 0 : 1;
+    }
     // Start Main Controller
     AppController appController;
     appController.start();